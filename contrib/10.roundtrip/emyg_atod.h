@@ -1,14 +0,0 @@
-/* emyg_atod.h */
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-double emyg_strtod (const char *nptr, char **endptr);
-
-double emyg_atod (const char *nptr);
-
-#ifdef __cplusplus
-}
-#endif
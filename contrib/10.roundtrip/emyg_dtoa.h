@@ -1,12 +0,0 @@
-/* emyg_dtoa.h */
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-void emyg_dtoa (double value, char *buffer);
-
-#ifdef __cplusplus
-}
-#endif
-
@@ -31,6 +31,44 @@
 
 (test #t (nan? (string->number "+nan.0")))
 
+(test 255 (string->number "ff" 16))
+
+(test 255 #xff)
+
+(test -5 #b-101)
+
+(test 511 #o777)
+
+(test 16 #e#x10)
+
+(test 3.0 #i3)
+
+(test 1 #e1.5)
+
+(test #f (string->number "#x#x1"))
+
+(test #f (string->number "1e"))
+
+(test 0.5 .5)
+
+(test 2.2250738585072011e-308 (string->number "2.2250738585072011e-308"))
+
+(test 9007199254740992.0 (string->number "9007199254740993"))
+
+(test +inf.0 (string->number "1e400"))
+
+(test 0.0 (string->number "4289.048e-329"))
+
+(test 0.0 (string->number "3.48497e-328"))
+
+(test 0.0 (string->number "0.8374520e-326"))
+
+(test #t (eqv? -0.0 (string->number "-3.48497e-328")))
+
+(test 5e-324 (string->number "3e-324"))
+
+(test 0.0 (string->number "1e-400"))
+
 (define (random-roundtrip)
   (let ((r (random-real)))
     (if (rountrip-ok r)
@@ -13,7 +13,7 @@
       (inc! counter)
       (make-library lib)
       (parameterize ((current-library lib))
-        (eval `(import ,@specs) lib))
-      lib))
+        (eval `(import ,@specs) (library-environment lib)))
+      (library-environment lib)))
 
   (export environment eval))
@@ -6,36 +6,272 @@
 #include "picrin/extra.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 
+/*
+ * If the environment variable PICRIN_CACHE_DIR names a directory, load
+ * keeps there the image (see make-library-image) of each file it
+ * evaluates, and the next time the same file is loaded the image is
+ * replayed instead of reading, expanding and compiling the file again.
+ *
+ * An image is looked up by a hash of the file contents, CACHE_VERSION,
+ * the library the file is loaded into and the number of identifiers made
+ * so far. The last stands for the libraries loaded before, and keeps the
+ * identifiers numbered in the image from clashing with those made since.
+ * The files the code included are hashed into the entry as well, and the
+ * entry is ignored when any of them has changed or it cannot be read.
+ */
+
+#define CACHE_VERSION 1         /* bump when the compiler output changes */
+
+struct hash {
+  unsigned long fnv, djb;       /* 32 bits each */
+};
+
+static void
+hash_init(struct hash *h)
+{
+  h->fnv = 2166136261UL;
+  h->djb = 5381;
+}
+
+static void
+hash_update(struct hash *h, const unsigned char *buf, int len)
+{
+  int i;
+
+  for (i = 0; i < len; ++i) {
+    h->fnv = ((h->fnv ^ buf[i]) * 16777619UL) & 0xffffffffUL;
+    h->djb = (h->djb * 33 + buf[i]) & 0xffffffffUL;
+  }
+}
+
+static void
+hash_str(struct hash *h, const char *str)
+{
+  hash_update(h, (const unsigned char *) str, strlen(str) + 1);
+}
+
+static void
+hash_name(pic_state *pic, struct hash *h, pic_value name)
+{
+  char buf[32];
+
+  if (pic_sym_p(pic, name)) {
+    hash_str(h, pic_str(pic, pic_sym_name(pic, name), NULL));
+  } else if (pic_int_p(pic, name)) {
+    sprintf(buf, "%d", pic_int(pic, name));
+    hash_str(h, buf);
+  } else if (pic_pair_p(pic, name)) {
+    hash_name(pic, h, pic_car(pic, name));
+    hash_str(h, ".");
+    hash_name(pic, h, pic_cdr(pic, name));
+  }
+}
+
+static void
+hash_digest(struct hash *h, char *buf)
+{
+  sprintf(buf, "%08lx%08lx", h->fnv, h->djb);
+}
+
+/* the contents of a file in a bytevector, or #f */
 static pic_value
-pic_load_load(pic_state *pic)
+read_file(pic_state *pic, const char *fn)
 {
-  pic_value envid, port, e;
-  char *fn;
   FILE *fp;
+  pic_value blob;
+  long len;
+
+  if ((fp = fopen(fn, "rb")) == NULL) {
+    return pic_false_value(pic);
+  }
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  blob = pic_blob_value(pic, NULL, len < 0 ? 0 : len);
+  if (len < 0 || fread(pic_blob(pic, blob, NULL), 1, len, fp) != (size_t) len) {
+    blob = pic_false_value(pic);
+  }
+  fclose(fp);
+  return blob;
+}
 
-  pic_get_args(pic, "z|o", &fn, &envid);
+static bool
+file_hash(pic_state *pic, const char *fn, char *digest)
+{
+  pic_value contents = read_file(pic, fn);
+  const unsigned char *buf;
+  struct hash h;
+  int len;
 
-  fp = fopen(fn, "r");
-  if (fp == NULL) {
+  if (pic_false_p(pic, contents)) {
+    return false;
+  }
+  buf = pic_blob(pic, contents, &len);
+  hash_init(&h);
+  hash_update(&h, buf, len);
+  hash_digest(&h, digest);
+  return true;
+}
+
+static pic_value
+eval_file(pic_state *pic)
+{
+  pic_value port = pic_closure_ref(pic, 0), env = pic_closure_ref(pic, 1), form;
+  size_t ai;
+
+  pic_get_args(pic, "");
+
+  ai = pic_enter(pic);
+  while (1) {
+    form = pic_funcall(pic, "read", 1, port);
+    if (pic_eof_p(pic, form))
+      break;
+    pic_funcall(pic, "eval", 2, form, env);
+    pic_leave(pic, ai);
+  }
+  pic_set_car(pic, pic_closure_ref(pic, 2), pic_true_value(pic));
+  return pic_undef_value(pic);
+}
+
+/* replays the cached image at path, if there is a valid one */
+static bool
+load_cached(pic_state *pic, const char *path)
+{
+  pic_value bin, entry, includes, it, inc, image, e;
+  char digest[17];
+  bool valid = false;
+
+  bin = read_file(pic, path);
+  if (pic_false_p(pic, bin)) {
+    return false;
+  }
+
+  /* (((filename . digest) ...) image) */
+  pic_try {
+    entry = pic_deserialize(pic, bin);
+    includes = pic_car(pic, entry);
+    valid = true;
+    pic_for_each (inc, includes, it) {
+      if (! file_hash(pic, pic_str(pic, pic_car(pic, inc), NULL), digest)
+          || strcmp(digest, pic_str(pic, pic_cdr(pic, inc), NULL)) != 0) {
+        valid = false;
+      }
+    }
+    if (valid) {
+      image = pic_funcall(pic, "read-library-image", 1, pic_list_ref(pic, entry, 1));
+    }
+  }
+  pic_catch(e) {
+    (void) e;
+    valid = false;
+  }
+  if (! valid) {
+    return false;
+  }
+
+  /* errors from here on are the code's own */
+  pic_funcall(pic, "load-library-image", 1, image);
+  return true;
+}
+
+/* writes the image of the file to path unless something it needs is gone */
+static void
+save_cached(pic_state *pic, const char *path, pic_value image, pic_value files)
+{
+  pic_value includes = pic_nil_value(pic), it, fn, bin;
+  char digest[17], tmp[FILENAME_MAX];
+  const unsigned char *buf;
+  FILE *fp;
+  int len;
+
+  pic_for_each (fn, files, it) {
+    if (! file_hash(pic, pic_str(pic, fn, NULL), digest)) {
+      return;
+    }
+    pic_push(pic, pic_cons(pic, fn, pic_cstr_value(pic, digest)), includes);
+  }
+  bin = pic_serialize(pic, pic_list(pic, 2, includes, image));
+  buf = pic_blob(pic, bin, &len);
+
+  /* the complete entry appears at once, also to other processes */
+  if (strlen(path) + 5 > sizeof tmp) {
+    return;
+  }
+  sprintf(tmp, "%s.tmp", path);
+  if ((fp = fopen(tmp, "wb")) == NULL) {
+    return;
+  }
+  if (fwrite(buf, 1, len, fp) != (size_t) len || fclose(fp) != 0) {
+    remove(tmp);
+    return;
+  }
+  if (rename(tmp, path) != 0) {
+    remove(tmp);
+  }
+}
+
+static pic_value
+pic_load_load(pic_state *pic)
+{
+  pic_value envid, env, contents, port, done, thunk, r, e;
+  char *fn, path[FILENAME_MAX], digest[17];
+  const char *dir;
+  struct hash h;
+  int n, len;
+  const unsigned char *buf;
+
+  n = pic_get_args(pic, "z|o", &fn, &envid);
+
+  if (n == 1) {
+    envid = pic_funcall(pic, "current-library", 0);
+  }
+  env = pic_funcall(pic, "library-environment", 1, envid);
+
+  contents = read_file(pic, fn);
+  if (pic_false_p(pic, contents)) {
     pic_error(pic, "load: could not open file", 1, pic_cstr_value(pic, fn));
   }
+  buf = pic_blob(pic, contents, &len);
+
+  dir = getenv("PICRIN_CACHE_DIR");
+  if (dir && *dir && strlen(dir) + 24 <= sizeof path) {
+    hash_init(&h);
+    hash_update(&h, buf, len);
+    sprintf(path, "%d", CACHE_VERSION);
+    hash_str(&h, path);
+    hash_name(pic, &h, envid);
+    sprintf(path, "%d", pic_int(pic, pic_funcall(pic, "identifier-count", 0)));
+    hash_str(&h, path);
+    hash_digest(&h, digest);
+    sprintf(path, "%s/%s.fasl", dir, digest);
 
-  port = pic_fopen(pic, fp, "r");
+    if (load_cached(pic, path)) {
+      return pic_undef_value(pic);
+    }
+  } else {
+    dir = NULL;
+  }
+
+  port = pic_fmemopen(pic, (const char *) buf, len, "r");
+  done = pic_cons(pic, pic_false_value(pic), pic_nil_value(pic));
+  thunk = pic_lambda(pic, eval_file, 3, port, env, done);
   pic_try {
-    size_t ai = pic_enter(pic);
-
-    while (1) {
-      pic_value form = pic_funcall(pic, "read", 1, port);
-      if (pic_eof_p(pic, form))
-        break;
-      pic_funcall(pic, "eval", 1, form);
-      pic_leave(pic, ai);
+    if (dir) {
+      r = pic_funcall(pic, "make-library-image", 1, thunk);
+      save_cached(pic, path, pic_car(pic, r), pic_list_ref(pic, r, 3));
+    } else {
+      pic_call(pic, thunk, 0);
     }
   }
   pic_catch (e) {
     pic_fclose(pic, port);
-    pic_raise(pic, e);
+    /* unless the image alone could not be made */
+    if (! dir || pic_false_p(pic, pic_car(pic, done))) {
+      pic_raise(pic, e);
+    }
+    return pic_undef_value(pic);
   }
   pic_fclose(pic, port);
 
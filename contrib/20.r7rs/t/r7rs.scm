@@ -1346,6 +1346,7 @@
 (test "" (string-copy "" 0))
 (test "" (string-copy "" 0 0))
 (test "abc" (string-copy "abc"))
+(test #t (string? (string-copy "abc")))
 (test "abc" (string-copy "abc" 0))
 (test "bc" (string-copy "abc" 1))
 (test "b" (string-copy "abc" 1 2))
@@ -0,0 +1,9 @@
+CONTRIB_SRCS += contrib/30.channel/src/channel.c
+CONTRIB_INITS += channel
+CONTRIB_TESTS += test-channel
+LDFLAGS += -pthread
+
+test-channel: $(TEST_RUNNER)
+	for test in `ls contrib/30.channel/t/*.scm`; do \
+	  ./$(TEST_RUNNER) $$test; \
+	done
@@ -0,0 +1,297 @@
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/lib.h"
+#include "picrin/channel.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+/*
+ * A channel is shared by any number of states, each of which holds it
+ * through a data object of its own. Senders link messages into a queue
+ * with a single atomic exchange and never take the lock; receivers take
+ * turns under it, and sleep on it while the channel is empty.
+ *
+ * A message is the fasl encoding of the value sent, or the contents of a
+ * bytevector given away. The buffer is handed over as it is: it was
+ * allocated by the sender and becomes a bytevector of the receiver, so
+ * the states on a channel must share an allocator.
+ */
+
+struct message {
+  struct message *next;
+  unsigned char *buf;
+  int len;
+  int raw;                      /* buf is not a fasl but the bytevector itself */
+};
+
+struct pic_channel {
+  struct message *head;         /* the last message pushed */
+  struct message *tail;         /* the next one to pop, or stub */
+  struct message stub;
+  int pending;                  /* messages pushed or being pushed, not yet popped */
+  int waiting;                  /* receivers going to sleep */
+  int refs;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  void (*notify)(void *);
+  void *arg;
+};
+
+static void
+push(struct pic_channel *ch, struct message *m)
+{
+  struct message *prev;
+
+  m->next = NULL;
+  prev = __atomic_exchange_n(&ch->head, m, __ATOMIC_ACQ_REL);
+  __atomic_store_n(&prev->next, m, __ATOMIC_RELEASE);
+}
+
+/* NULL if empty, or if the next message is still being pushed */
+static struct message *
+pop(struct pic_channel *ch)
+{
+  struct message *tail = ch->tail, *next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+
+  if (tail == &ch->stub) {
+    if (next == NULL) {
+      return NULL;
+    }
+    ch->tail = tail = next;
+    next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+  }
+  if (next != NULL) {
+    ch->tail = next;
+    return tail;
+  }
+  if (tail != __atomic_load_n(&ch->head, __ATOMIC_ACQUIRE)) {
+    return NULL;
+  }
+  push(ch, &ch->stub);
+  next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+  if (next != NULL) {
+    ch->tail = next;
+    return tail;
+  }
+  return NULL;
+}
+
+static void
+channel_send(pic_state *pic, struct pic_channel *ch, pic_value blob, int raw)
+{
+  struct message *m;
+  int prev;
+
+  m = pic_malloc(pic, sizeof(struct message));
+  m->buf = pic_blob_take(pic, blob, &m->len);
+  m->raw = raw;
+
+  prev = __atomic_fetch_add(&ch->pending, 1, __ATOMIC_SEQ_CST);
+  push(ch, m);
+
+  if (__atomic_load_n(&ch->waiting, __ATOMIC_SEQ_CST) != 0) {
+    pthread_mutex_lock(&ch->lock);
+    pthread_cond_signal(&ch->cond);
+    pthread_mutex_unlock(&ch->lock);
+  }
+  if (prev == 0) {
+    void (*notify)(void *) = __atomic_load_n(&ch->notify, __ATOMIC_ACQUIRE);
+
+    if (notify != NULL) {
+      notify(__atomic_load_n(&ch->arg, __ATOMIC_RELAXED));
+    }
+  }
+}
+
+static struct message *
+channel_receive(struct pic_channel *ch, int wait)
+{
+  struct message *m;
+
+  pthread_mutex_lock(&ch->lock);
+  while ((m = pop(ch)) == NULL) {
+    if (__atomic_load_n(&ch->pending, __ATOMIC_SEQ_CST) != 0) {
+      /* a sender is between its exchange and its store */
+      pthread_mutex_unlock(&ch->lock);
+      sched_yield();
+      pthread_mutex_lock(&ch->lock);
+      continue;
+    }
+    if (! wait) {
+      break;
+    }
+    /* senders look at waiting after counting their message in pending */
+    __atomic_add_fetch(&ch->waiting, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ch->pending, __ATOMIC_SEQ_CST) == 0) {
+      pthread_cond_wait(&ch->cond, &ch->lock);
+    }
+    __atomic_sub_fetch(&ch->waiting, 1, __ATOMIC_SEQ_CST);
+  }
+  if (m != NULL) {
+    __atomic_sub_fetch(&ch->pending, 1, __ATOMIC_SEQ_CST);
+  }
+  pthread_mutex_unlock(&ch->lock);
+  return m;
+}
+
+static pic_value
+unpack(pic_state *pic, struct message *m)
+{
+  pic_value blob;
+  int raw = m->raw;
+
+  blob = pic_blob_adopt(pic, m->buf, m->len);
+  pic_free(pic, m);
+  return raw ? blob : pic_deserialize(pic, blob);
+}
+
+static void
+channel_dtor(pic_state *pic, void *data)
+{
+  struct pic_channel *ch = data;
+  struct message *m;
+
+  if (__atomic_sub_fetch(&ch->refs, 1, __ATOMIC_ACQ_REL) != 0) {
+    return;
+  }
+  while ((m = channel_receive(ch, 0)) != NULL) {
+    pic_free(pic, m->buf);
+    pic_free(pic, m);
+  }
+  pthread_mutex_destroy(&ch->lock);
+  pthread_cond_destroy(&ch->cond);
+  pic_free(pic, ch);
+}
+
+static const pic_data_type channel_type = { "channel", channel_dtor, NULL };
+
+pic_value
+pic_make_channel(pic_state *pic)
+{
+  struct pic_channel *ch;
+
+  ch = pic_malloc(pic, sizeof(struct pic_channel));
+  ch->stub.next = NULL;
+  ch->head = ch->tail = &ch->stub;
+  ch->pending = ch->waiting = 0;
+  ch->refs = 0;
+  ch->notify = NULL;
+  ch->arg = NULL;
+  pthread_mutex_init(&ch->lock, NULL);
+  pthread_cond_init(&ch->cond, NULL);
+  return pic_channel_value(pic, ch);
+}
+
+/* ch stays valid while some state holds it */
+struct pic_channel *
+pic_channel_ptr(pic_state *pic, pic_value ch)
+{
+  if (! pic_data_p(pic, ch, &channel_type)) {
+    pic_error(pic, "channel required", 1, ch);
+  }
+  return pic_data(pic, ch);
+}
+
+pic_value
+pic_channel_value(pic_state *pic, struct pic_channel *ch)
+{
+  __atomic_add_fetch(&ch->refs, 1, __ATOMIC_ACQ_REL);
+  return pic_data_value(pic, ch, &channel_type);
+}
+
+void
+pic_channel_notify(struct pic_channel *ch, void (*notify)(void *), void *arg)
+{
+  /* arg first, so that a sender that sees notify sees its arg too */
+  __atomic_store_n(&ch->arg, arg, __ATOMIC_RELAXED);
+  __atomic_store_n(&ch->notify, notify, __ATOMIC_RELEASE);
+}
+
+static pic_value
+pic_channel_make_channel(pic_state *pic)
+{
+  pic_get_args(pic, "");
+
+  return pic_make_channel(pic);
+}
+
+static pic_value
+pic_channel_channel_p(pic_state *pic)
+{
+  pic_value obj;
+
+  pic_get_args(pic, "o", &obj);
+
+  return pic_bool_value(pic, pic_data_p(pic, obj, &channel_type));
+}
+
+static pic_value
+pic_channel_channel_send(pic_state *pic)
+{
+  struct pic_channel *ch;
+  pic_value obj;
+
+  pic_get_args(pic, "uo", &ch, &channel_type, &obj);
+
+  channel_send(pic, ch, pic_serialize(pic, obj), 0);
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_channel_channel_give(pic_state *pic)
+{
+  struct pic_channel *ch;
+  pic_value blob;
+
+  pic_get_args(pic, "uo", &ch, &channel_type, &blob);
+
+  if (! pic_blob_p(pic, blob)) {
+    pic_error(pic, "bytevector required", 1, blob);
+  }
+  channel_send(pic, ch, blob, 1);
+
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_channel_channel_receive(pic_state *pic)
+{
+  struct pic_channel *ch;
+
+  pic_get_args(pic, "u", &ch, &channel_type);
+
+  return unpack(pic, channel_receive(ch, 1));
+}
+
+static pic_value
+pic_channel_channel_try_receive(pic_state *pic)
+{
+  struct pic_channel *ch;
+  struct message *m;
+  pic_value fallback = pic_false_value(pic);
+
+  pic_get_args(pic, "u|o", &ch, &channel_type, &fallback);
+
+  m = channel_receive(ch, 0);
+  return m == NULL ? fallback : unpack(pic, m);
+}
+
+void
+pic_nitro_init_channel(pic_state *pic)
+{
+  pic_deflibrary(pic, "picrin.channel");
+  pic_in_library(pic, "picrin.channel");
+  pic_export(pic, 6,
+             "make-channel", "channel?",
+             "channel-send!", "channel-give!",
+             "channel-receive", "channel-try-receive");
+
+  pic_defun(pic, "picrin.channel:make-channel", pic_channel_make_channel);
+  pic_defun(pic, "picrin.channel:channel?", pic_channel_channel_p);
+  pic_defun(pic, "picrin.channel:channel-send!", pic_channel_channel_send);
+  pic_defun(pic, "picrin.channel:channel-give!", pic_channel_channel_give);
+  pic_defun(pic, "picrin.channel:channel-receive", pic_channel_channel_receive);
+  pic_defun(pic, "picrin.channel:channel-try-receive", pic_channel_channel_try_receive);
+}
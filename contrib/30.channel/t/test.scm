@@ -0,0 +1,31 @@
+(import (scheme base)
+        (picrin test)
+        (picrin channel))
+
+(define ch (make-channel))
+
+(test #t (channel? ch))
+(test #f (channel? (vector ch)))
+
+(test 'none (channel-try-receive ch 'none))
+(test #f (channel-try-receive ch))
+
+(channel-send! ch '(1 "two" #\3 4.5 #(six) #u8(7)))
+(channel-send! ch 'second)
+(test '(1 "two" #\3 4.5 #(six) #u8(7)) (channel-receive ch))
+(test 'second (channel-receive ch))
+
+(define shared (list 1 2))
+(channel-send! ch (vector shared shared))
+(let ((v (channel-receive ch)))
+  (test #t (eq? (vector-ref v 0) (vector-ref v 1)))
+  (test #f (eq? (vector-ref v 0) shared)))
+
+(define bv (make-bytevector 100000 42))
+(channel-give! ch bv)
+(test 0 (bytevector-length bv))
+(let ((got (channel-receive ch)))
+  (test 100000 (bytevector-length got))
+  (test 42 (bytevector-u8-ref got 99999)))
+
+(test 'none (channel-try-receive ch 'none))
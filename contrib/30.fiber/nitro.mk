@@ -0,0 +1,9 @@
+CONTRIB_INITS += fiber
+CONTRIB_SRCS += contrib/30.fiber/src/fiber.c
+CONTRIB_LIBS += contrib/30.fiber/piclib/fiber.scm
+CONTRIB_TESTS += test-fiber
+
+test-fiber: $(TEST_RUNNER)
+	for test in `ls contrib/30.fiber/t/*.scm`; do \
+	  ./$(TEST_RUNNER) $$test; \
+	done
@@ -0,0 +1,20 @@
+(define-library (picrin fiber)
+  (import (scheme base))
+
+  ;; the body of a fiber never returns: %exit switches to another one
+  (define (run-fibers thunk)
+    (%run-fibers (lambda () (%exit (thunk)))))
+
+  (define (spawn thunk)
+    (%spawn (lambda () (%exit (thunk)))))
+
+  (export run-fibers
+          spawn
+          fiber?
+          yield
+          join
+          sleep
+          make-fiber-channel
+          fiber-channel?
+          fiber-send!
+          fiber-receive))
@@ -0,0 +1,490 @@
+#include "picrin.h"
+#include "picrin/extra.h"
+
+#include <time.h>
+
+/*
+ * Fibers are Scheme computations that take turns on one state. The
+ * scheduler runs in the context of run-fibers: a fiber gives up its turn
+ * by handing its continuation over with pic_currentk, and the next one
+ * goes on by pic_resumek, so a switch is a plain call within the VM.
+ * For the same reason a fiber cannot switch from under a C function it
+ * has called, such as the procedure given to map.
+ */
+
+#define SCHEDULER "picrin.fiber:%scheduler"
+
+enum { READY, RUNNING, BLOCKED, SLEEPING, DONE };
+
+struct fiber {
+  int state;
+  pic_value k;                  /* its body until it starts, then what resumes it */
+  pic_value value;              /* passed to k, or the result once done */
+  pic_value joiners;            /* fibers waiting for it to finish */
+  pic_value next;               /* in a queue of fibers, or #f */
+  pic_value sched;
+  double wake;                  /* when sleeping */
+};
+
+struct queue {
+  pic_value head, tail;         /* fibers linked through next */
+};
+
+struct sched {
+  pic_value home;               /* continuation of run-fibers */
+  pic_value main, current;
+  struct queue ready;
+  pic_value sleepers;           /* by wake time */
+  int live;                     /* fibers not done */
+  int running;
+};
+
+struct chan {
+  pic_value msgs, last;         /* list of values not received yet */
+  struct queue waiters;
+};
+
+static void
+fiber_dtor(pic_state *pic, void *data)
+{
+  pic_free(pic, data);
+}
+
+static void
+fiber_mark(pic_state *pic, void *data, void (*mark)(pic_state *, pic_value))
+{
+  struct fiber *f = data;
+
+  mark(pic, f->k);
+  mark(pic, f->value);
+  mark(pic, f->joiners);
+  mark(pic, f->next);
+  mark(pic, f->sched);
+}
+
+static void
+sched_mark(pic_state *pic, void *data, void (*mark)(pic_state *, pic_value))
+{
+  struct sched *s = data;
+
+  mark(pic, s->home);
+  mark(pic, s->main);
+  mark(pic, s->current);
+  mark(pic, s->ready.head);
+  mark(pic, s->ready.tail);
+  mark(pic, s->sleepers);
+}
+
+static void
+chan_mark(pic_state *pic, void *data, void (*mark)(pic_state *, pic_value))
+{
+  struct chan *ch = data;
+
+  mark(pic, ch->msgs);
+  mark(pic, ch->last);
+  mark(pic, ch->waiters.head);
+  mark(pic, ch->waiters.tail);
+}
+
+static const pic_data_type fiber_type = { "fiber", fiber_dtor, fiber_mark };
+static const pic_data_type sched_type = { "scheduler", fiber_dtor, sched_mark };
+static const pic_data_type chan_type = { "fiber-channel", fiber_dtor, chan_mark };
+
+#define fiber_ptr(pic, v) ((struct fiber *) pic_data(pic, v))
+#define sched_ptr(pic, v) ((struct sched *) pic_data(pic, v))
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+enqueue(pic_state *pic, struct queue *q, pic_value f)
+{
+  fiber_ptr(pic, f)->next = pic_false_value(pic);
+  if (pic_false_p(pic, q->head)) {
+    q->head = f;
+  } else {
+    fiber_ptr(pic, q->tail)->next = f;
+  }
+  q->tail = f;
+}
+
+static pic_value
+dequeue(pic_state *pic, struct queue *q)
+{
+  pic_value f = q->head;
+
+  q->head = fiber_ptr(pic, f)->next;
+  fiber_ptr(pic, f)->next = pic_false_value(pic);
+  if (pic_false_p(pic, q->head)) {
+    q->tail = pic_false_value(pic);
+  }
+  return f;
+}
+
+static pic_value
+make_fiber(pic_state *pic, pic_value sched, pic_value body)
+{
+  struct fiber *f;
+
+  f = pic_malloc(pic, sizeof(struct fiber));
+  f->state = READY;
+  f->k = body;
+  f->value = pic_undef_value(pic);
+  f->joiners = pic_nil_value(pic);
+  f->next = pic_false_value(pic);
+  f->sched = sched;
+  f->wake = 0;
+  sched_ptr(pic, sched)->live++;
+  return pic_data_value(pic, f, &fiber_type);
+}
+
+/* the scheduler of the running fiber */
+static struct sched *
+scheduler(pic_state *pic)
+{
+  pic_value s = pic_ref(pic, SCHEDULER);
+
+  if (pic_false_p(pic, s)) {
+    pic_error(pic, "not running fibers", 0);
+  }
+  if (! pic_resumable_p(pic, sched_ptr(pic, s)->home)) {
+    pic_error(pic, "fibers cannot switch inside a call from C", 0);
+  }
+  return sched_ptr(pic, s);
+}
+
+static void
+make_ready(pic_state *pic, pic_value f, pic_value value)
+{
+  struct fiber *fp = fiber_ptr(pic, f);
+
+  fp->state = READY;
+  fp->value = value;
+  enqueue(pic, &sched_ptr(pic, fp->sched)->ready, f);
+}
+
+/* takes the continuation of the running fiber, which must call dispatch next */
+static pic_value
+suspend(pic_state *pic, struct sched *s, int state)
+{
+  struct fiber *f = fiber_ptr(pic, s->current);
+
+  f->k = pic_currentk(pic);
+  f->state = state;
+  return s->current;
+}
+
+static void
+wake(pic_state *pic, struct sched *s, int wait)
+{
+  double t = now();
+  pic_value f;
+
+  if (wait && fiber_ptr(pic, pic_car(pic, s->sleepers))->wake > t) {
+    struct timespec ts;
+    double d = fiber_ptr(pic, pic_car(pic, s->sleepers))->wake - t;
+
+    ts.tv_sec = (time_t) d;
+    ts.tv_nsec = (long) ((d - ts.tv_sec) * 1e9);
+    nanosleep(&ts, NULL);
+    t = now();
+  }
+  while (! pic_nil_p(pic, s->sleepers) && fiber_ptr(pic, f = pic_car(pic, s->sleepers))->wake <= t) {
+    s->sleepers = pic_cdr(pic, s->sleepers);
+    make_ready(pic, f, pic_undef_value(pic));
+  }
+}
+
+/* passes the turn to the next fiber ready, or returns from run-fibers */
+static pic_value
+dispatch(pic_state *pic, struct sched *s)
+{
+  struct fiber *f;
+  pic_value k;
+
+  while (1) {
+    if (! pic_nil_p(pic, s->sleepers)) {
+      wake(pic, s, pic_false_p(pic, s->ready.head));
+    }
+    if (! pic_false_p(pic, s->ready.head)) {
+      break;
+    }
+    if (s->live == 0) {
+      s->current = pic_false_value(pic);
+      return pic_resumek(pic, s->home, 1, &fiber_ptr(pic, s->main)->value);
+    }
+    if (pic_nil_p(pic, s->sleepers)) {
+      pic_error(pic, "all fibers are blocked", 0);
+    }
+  }
+  s->current = dequeue(pic, &s->ready);
+  f = fiber_ptr(pic, s->current);
+  f->state = RUNNING;
+  k = f->k;
+  f->k = pic_false_value(pic);
+  return pic_resumek(pic, k, 1, &f->value);
+}
+
+/* starts a fiber made just now in place of the running one */
+static pic_value
+start(pic_state *pic, struct sched *s, pic_value f)
+{
+  pic_value body = fiber_ptr(pic, f)->k;
+
+  s->current = f;
+  fiber_ptr(pic, f)->state = RUNNING;
+  fiber_ptr(pic, f)->k = pic_false_value(pic);
+  return pic_applyk(pic, body, 0, NULL);
+}
+
+static pic_value
+run_main(pic_state *pic)
+{
+  pic_value s = pic_closure_ref(pic, 0);
+  struct sched *sp = sched_ptr(pic, s);
+
+  pic_get_args(pic, "");
+
+  sp->home = pic_currentk(pic);
+  sp->main = make_fiber(pic, s, pic_closure_ref(pic, 1));
+  return start(pic, sp, sp->main);
+}
+
+static pic_value
+pic_fiber_run_fibers(pic_state *pic)
+{
+  pic_value body, s, outer, r, e;
+  struct sched *sp;
+
+  pic_get_args(pic, "l", &body);
+
+  sp = pic_malloc(pic, sizeof(struct sched));
+  sp->home = sp->main = sp->current = pic_false_value(pic);
+  sp->ready.head = sp->ready.tail = pic_false_value(pic);
+  sp->sleepers = pic_nil_value(pic);
+  sp->live = 0;
+  sp->running = 1;
+  s = pic_data_value(pic, sp, &sched_type);
+
+  outer = pic_ref(pic, SCHEDULER);
+  pic_set(pic, SCHEDULER, s);
+  pic_try {
+    r = pic_call(pic, pic_lambda(pic, run_main, 2, s, body), 0);
+  }
+  pic_catch(e) {
+    sp->running = 0;
+    pic_set(pic, SCHEDULER, outer);
+    pic_raise(pic, e);
+  }
+  sp->running = 0;
+  pic_set(pic, SCHEDULER, outer);
+  return r;
+}
+
+static pic_value
+pic_fiber_exit(pic_state *pic)
+{
+  struct sched *s;
+  struct fiber *f;
+  pic_value value, j, it;
+
+  pic_get_args(pic, "o", &value);
+
+  s = scheduler(pic);
+  f = fiber_ptr(pic, s->current);
+  f->state = DONE;
+  f->value = value;
+  s->live--;
+  pic_for_each (j, f->joiners, it) {
+    make_ready(pic, j, value);
+  }
+  f->joiners = pic_nil_value(pic);
+  return dispatch(pic, s);
+}
+
+static pic_value
+pic_fiber_spawn(pic_state *pic)
+{
+  struct sched *s;
+  pic_value body, self, f;
+
+  pic_get_args(pic, "l", &body);
+
+  s = scheduler(pic);
+  self = suspend(pic, s, READY);
+  f = make_fiber(pic, fiber_ptr(pic, self)->sched, body);
+  make_ready(pic, self, f);
+  return start(pic, s, f);
+}
+
+static pic_value
+pic_fiber_fiber_p(pic_state *pic)
+{
+  pic_value obj;
+
+  pic_get_args(pic, "o", &obj);
+
+  return pic_bool_value(pic, pic_data_p(pic, obj, &fiber_type));
+}
+
+static pic_value
+pic_fiber_yield(pic_state *pic)
+{
+  struct sched *s;
+
+  pic_get_args(pic, "");
+
+  s = scheduler(pic);
+  if (pic_false_p(pic, s->ready.head) && pic_nil_p(pic, s->sleepers)) {
+    return pic_undef_value(pic);
+  }
+  make_ready(pic, suspend(pic, s, READY), pic_undef_value(pic));
+  return dispatch(pic, s);
+}
+
+static pic_value
+pic_fiber_join(pic_state *pic)
+{
+  struct sched *s;
+  struct fiber *f;
+  pic_value fiber;
+
+  pic_get_args(pic, "o", &fiber);
+
+  if (! pic_data_p(pic, fiber, &fiber_type)) {
+    pic_error(pic, "fiber required", 1, fiber);
+  }
+  f = fiber_ptr(pic, fiber);
+  if (f->state == DONE) {
+    return f->value;
+  }
+  s = scheduler(pic);
+  if (pic_eq_p(pic, fiber, s->current)) {
+    pic_error(pic, "a fiber cannot join itself", 0);
+  }
+  if (sched_ptr(pic, f->sched) != s) {
+    pic_error(pic, "fiber of another run-fibers", 1, fiber);
+  }
+  f->joiners = pic_cons(pic, suspend(pic, s, BLOCKED), f->joiners);
+  return dispatch(pic, s);
+}
+
+static pic_value
+pic_fiber_sleep(pic_state *pic)
+{
+  struct sched *s;
+  pic_value self, prev, it;
+  double secs, wake;
+
+  pic_get_args(pic, "f", &secs);
+
+  s = scheduler(pic);
+  self = suspend(pic, s, SLEEPING);
+  wake = fiber_ptr(pic, self)->wake = now() + secs;
+
+  /* after those due no later */
+  prev = pic_false_value(pic);
+  for (it = s->sleepers; ! pic_nil_p(pic, it) && fiber_ptr(pic, pic_car(pic, it))->wake <= wake; it = pic_cdr(pic, it)) {
+    prev = it;
+  }
+  if (pic_false_p(pic, prev)) {
+    s->sleepers = pic_cons(pic, self, s->sleepers);
+  } else {
+    pic_set_cdr(pic, prev, pic_cons(pic, self, it));
+  }
+  return dispatch(pic, s);
+}
+
+static pic_value
+pic_fiber_make_fiber_channel(pic_state *pic)
+{
+  struct chan *ch;
+
+  pic_get_args(pic, "");
+
+  ch = pic_malloc(pic, sizeof(struct chan));
+  ch->msgs = ch->last = pic_nil_value(pic);
+  ch->waiters.head = ch->waiters.tail = pic_false_value(pic);
+  return pic_data_value(pic, ch, &chan_type);
+}
+
+static pic_value
+pic_fiber_fiber_channel_p(pic_state *pic)
+{
+  pic_value obj;
+
+  pic_get_args(pic, "o", &obj);
+
+  return pic_bool_value(pic, pic_data_p(pic, obj, &chan_type));
+}
+
+static pic_value
+pic_fiber_fiber_send(pic_state *pic)
+{
+  struct chan *ch;
+  pic_value obj, f, cell;
+
+  pic_get_args(pic, "uo", &ch, &chan_type, &obj);
+
+  while (! pic_false_p(pic, ch->waiters.head)) {
+    f = dequeue(pic, &ch->waiters);
+    /* skip fibers left behind by a run-fibers that failed */
+    if (sched_ptr(pic, fiber_ptr(pic, f)->sched)->running) {
+      make_ready(pic, f, obj);
+      return pic_undef_value(pic);
+    }
+  }
+  cell = pic_cons(pic, obj, pic_nil_value(pic));
+  if (pic_nil_p(pic, ch->msgs)) {
+    ch->msgs = cell;
+  } else {
+    pic_set_cdr(pic, ch->last, cell);
+  }
+  ch->last = cell;
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_fiber_fiber_receive(pic_state *pic)
+{
+  struct chan *ch;
+  struct sched *s;
+  pic_value obj;
+
+  pic_get_args(pic, "u", &ch, &chan_type);
+
+  if (! pic_nil_p(pic, ch->msgs)) {
+    obj = pic_car(pic, ch->msgs);
+    ch->msgs = pic_cdr(pic, ch->msgs);
+    if (pic_nil_p(pic, ch->msgs)) {
+      ch->last = pic_nil_value(pic);
+    }
+    return obj;
+  }
+  s = scheduler(pic);
+  enqueue(pic, &ch->waiters, suspend(pic, s, BLOCKED));
+  return dispatch(pic, s);
+}
+
+void
+pic_nitro_init_fiber(pic_state *pic)
+{
+  pic_define(pic, SCHEDULER, pic_false_value(pic));
+  pic_defun(pic, "picrin.fiber:%run-fibers", pic_fiber_run_fibers);
+  pic_defun(pic, "picrin.fiber:%exit", pic_fiber_exit);
+  pic_defun(pic, "picrin.fiber:%spawn", pic_fiber_spawn);
+  pic_defun(pic, "picrin.fiber:fiber?", pic_fiber_fiber_p);
+  pic_defun(pic, "picrin.fiber:yield", pic_fiber_yield);
+  pic_defun(pic, "picrin.fiber:join", pic_fiber_join);
+  pic_defun(pic, "picrin.fiber:sleep", pic_fiber_sleep);
+  pic_defun(pic, "picrin.fiber:make-fiber-channel", pic_fiber_make_fiber_channel);
+  pic_defun(pic, "picrin.fiber:fiber-channel?", pic_fiber_fiber_channel_p);
+  pic_defun(pic, "picrin.fiber:fiber-send!", pic_fiber_fiber_send);
+  pic_defun(pic, "picrin.fiber:fiber-receive", pic_fiber_fiber_receive);
+}
@@ -0,0 +1,108 @@
+(import (scheme base)
+        (picrin test)
+        (picrin fiber))
+
+(define log '())
+(define (note! x) (set! log (cons x log)))
+
+;; spawn runs the new fiber at once; yield lets the others have a turn
+(test 'done
+      (run-fibers
+       (lambda ()
+         (spawn (lambda () (note! 'a1) (yield) (note! 'a2)))
+         (note! 'main1)
+         (spawn (lambda () (note! 'b1) (yield) (note! 'b2)))
+         (note! 'main2)
+         (yield)
+         (note! 'main3)
+         'done)))
+(test '(a1 main1 b1 a2 main2 b2 main3) (reverse log))
+
+;; run-fibers waits for every fiber, not just the first
+(set! log '())
+(test 1 (run-fibers (lambda () (spawn (lambda () (yield) (yield) (note! 'late))) 1)))
+(test '(late) log)
+
+(test 55
+      (run-fibers
+       (lambda ()
+         (let ((fs (let loop ((i 1) (fs '()))
+                     (if (> i 10)
+                         fs
+                         (loop (+ i 1) (cons (let ((i i)) (spawn (lambda () (yield) i))) fs))))))
+           (let loop ((fs fs) (sum 0))
+             (if (null? fs) sum (loop (cdr fs) (+ sum (join (car fs))))))))))
+
+(test #t (run-fibers (lambda () (fiber? (spawn (lambda () 0))))))
+(test #f (fiber? 'fiber))
+
+;; channels
+(test '(0 1 2 3 4)
+      (run-fibers
+       (lambda ()
+         (let ((ch (make-fiber-channel)))
+           (spawn (lambda ()
+                    (let loop ((i 0))
+                      (when (< i 5)
+                        (fiber-send! ch i)
+                        (yield)
+                        (loop (+ i 1))))))
+           (let loop ((i 0) (acc '()))
+             (if (= i 5)
+                 (reverse acc)
+                 (loop (+ i 1) (cons (fiber-receive ch) acc))))))))
+
+(test #t (fiber-channel? (make-fiber-channel)))
+
+;; ping-pong through two channels
+(test 10000
+      (run-fibers
+       (lambda ()
+         (let ((ping (make-fiber-channel)) (pong (make-fiber-channel)))
+           (spawn (lambda ()
+                    (let loop ()
+                      (let ((n (fiber-receive ping)))
+                        (fiber-send! pong (+ n 1))
+                        (if (< n 9999) (loop))))))
+           (let loop ((n 0))
+             (if (= n 10000)
+                 n
+                 (begin (fiber-send! ping n) (loop (fiber-receive pong)))))))))
+
+;; sleepers wake in order
+(set! log '())
+(run-fibers
+ (lambda ()
+   (spawn (lambda () (sleep 0.03) (note! 'slow)))
+   (spawn (lambda () (sleep 0.01) (note! 'fast)))
+   (note! 'first)))
+(test '(first fast slow) (reverse log))
+
+;; parameterizations belong to each fiber
+(define p (make-parameter 'outer))
+(test '(a b)
+      (run-fibers
+       (lambda ()
+         (let ((f (spawn (lambda () (parameterize ((p 'b)) (yield) (p))))))
+           (parameterize ((p 'a))
+             (yield)
+             (list (p) (join f)))))))
+
+;; map calls its procedure from the VM, so fibers can switch in it
+(test 55
+      (run-fibers
+       (lambda ()
+         (apply + (map join (map (lambda (i) (spawn (lambda () (yield) i))) '(1 2 3 4 5 6 7 8 9 10)))))))
+
+;; errors
+(test 'caught
+      (run-fibers
+       (lambda ()
+         (join (spawn (lambda () (guard (e (#t 'caught)) (yield) (raise 'oops))))))))
+(test 'boom (guard (e (#t e)) (run-fibers (lambda () (spawn (lambda () (raise 'boom))) 'unreachable))))
+(test #t (guard (e (#t (error-object? e)))
+           (run-fibers (lambda () (fiber-receive (make-fiber-channel))))))
+(test #t (guard (e (#t (error-object? e))) (yield)))
+(test #t (guard (e (#t (error-object? e)))
+           (run-fibers (lambda () (assoc 1 '((1 . a)) (lambda (x y) (yield) #t))))))
+(test 3 (run-fibers (lambda () (+ 1 (run-fibers (lambda () (yield) 2))))))
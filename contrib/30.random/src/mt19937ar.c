@@ -41,18 +41,26 @@
    email: m-mat @ math.sci.hiroshima-u.ac.jp (remove space)
 */
 
+/*
+   Modified for picrin: the state vector is passed in as a struct
+   mt19937 (see mt19937ar.h) instead of living in static variables,
+   so that every interpreter has a generator of its own.
+*/
+
+#include "mt19937ar.h"
+
 /* Period parameters */
-#define N 624
+#define N MT19937_N
 #define M 397
 #define MATRIX_A 0x9908b0dfUL   /* constant vector a */
 #define UPPER_MASK 0x80000000UL /* most significant w-r bits */
 #define LOWER_MASK 0x7fffffffUL /* least significant r bits */
 
-static unsigned long mt[N]; /* the array for the state vector  */
-static int mti=N+1; /* mti==N+1 means mt[N] is not initialized */
+#define mt (g->mt)  /* the array for the state vector  */
+#define mti (g->mti) /* mti==N+1 means mt[N] is not initialized */
 
 /* initializes mt[N] with a seed */
-void init_genrand(unsigned long s)
+void init_genrand(struct mt19937 *g, unsigned long s)
 {
     mt[0]= s & 0xffffffffUL;
     for (mti=1; mti<N; mti++) {
@@ -71,10 +79,10 @@ void init_genrand(unsigned long s)
 /* init_key is the array for initializing keys */
 /* key_length is its length */
 /* slight change for C++, 2004/2/26 */
-void init_by_array(unsigned long init_key[], int key_length)
+void init_by_array(struct mt19937 *g, unsigned long init_key[], int key_length)
 {
     int i, j, k;
-    init_genrand(19650218UL);
+    init_genrand(g, 19650218UL);
     i=1; j=0;
     k = (N>key_length ? N : key_length);
     for (; k; k--) {
@@ -97,17 +105,17 @@ void init_by_array(unsigned long init_key[], int key_length)
 }
 
 /* generates a random number on [0,0xffffffff]-interval */
-unsigned long genrand_int32(void)
+unsigned long genrand_int32(struct mt19937 *g)
 {
     unsigned long y;
-    static unsigned long mag01[2]={0x0UL, MATRIX_A};
+    static const unsigned long mag01[2]={0x0UL, MATRIX_A};
     /* mag01[x] = x * MATRIX_A  for x=0,1 */
 
     if (mti >= N) { /* generate N words at one time */
         int kk;
 
         if (mti == N+1)   /* if init_genrand() has not been called, */
-            init_genrand(5489UL); /* a default initial seed is used */
+            init_genrand(g, 5489UL); /* a default initial seed is used */
 
         for (kk=0;kk<N-M;kk++) {
             y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
@@ -135,36 +143,36 @@ unsigned long genrand_int32(void)
 }
 
 /* generates a random number on [0,0x7fffffff]-interval */
-long genrand_int31(void)
+long genrand_int31(struct mt19937 *g)
 {
-    return (long)(genrand_int32()>>1);
+    return (long)(genrand_int32(g)>>1);
 }
 
 /* generates a random number on [0,1]-real-interval */
-double genrand_real1(void)
+double genrand_real1(struct mt19937 *g)
 {
-    return genrand_int32()*(1.0/4294967295.0);
+    return genrand_int32(g)*(1.0/4294967295.0);
     /* divided by 2^32-1 */
 }
 
 /* generates a random number on [0,1)-real-interval */
-double genrand_real2(void)
+double genrand_real2(struct mt19937 *g)
 {
-    return genrand_int32()*(1.0/4294967296.0);
+    return genrand_int32(g)*(1.0/4294967296.0);
     /* divided by 2^32 */
 }
 
 /* generates a random number on (0,1)-real-interval */
-double genrand_real3(void)
+double genrand_real3(struct mt19937 *g)
 {
-    return (((double)genrand_int32()) + 0.5)*(1.0/4294967296.0);
+    return (((double)genrand_int32(g)) + 0.5)*(1.0/4294967296.0);
     /* divided by 2^32 */
 }
 
 /* generates a random number on [0,1) with 53-bit resolution*/
-double genrand_res53(void)
+double genrand_res53(struct mt19937 *g)
 {
-    unsigned long a=genrand_int32()>>5, b=genrand_int32()>>6;
+    unsigned long a=genrand_int32(g)>>5, b=genrand_int32(g)>>6;
     return(a*67108864.0+b)*(1.0/9007199254740992.0);
 }
 /* These real versions are due to Isaku Wada, 2002/01/09 added */
@@ -173,19 +181,23 @@ double genrand_res53(void)
 
 #include <stdio.h>
 
+#undef mt
+#undef mti
+
 int main(void)
 {
     int i;
     unsigned long init[4]={0x123, 0x234, 0x345, 0x456}, length=4;
-    init_by_array(init, length);
+    struct mt19937 state, *g = &state;
+    init_by_array(g, init, length);
     printf("1000 outputs of genrand_int32()\n");
     for (i=0; i<1000; i++) {
-      printf("%10lu ", genrand_int32());
+      printf("%10lu ", genrand_int32(g));
       if (i%5==4) printf("\n");
     }
     printf("\n1000 outputs of genrand_real2()\n");
     for (i=0; i<1000; i++) {
-      printf("%10.8f ", genrand_real2());
+      printf("%10.8f ", genrand_real2(g));
       if (i%5==4) printf("\n");
     }
     return 0;
@@ -0,0 +1,24 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#ifndef MT19937AR_H
+#define MT19937AR_H
+
+#define MT19937_N 624
+
+struct mt19937 {
+  unsigned long mt[MT19937_N];
+  int mti;                      /* MT19937_N + 1 until seeded */
+};
+
+void init_genrand(struct mt19937 *, unsigned long s);
+void init_by_array(struct mt19937 *, unsigned long init_key[], int key_length);
+unsigned long genrand_int32(struct mt19937 *);
+long genrand_int31(struct mt19937 *);
+double genrand_real1(struct mt19937 *);
+double genrand_real2(struct mt19937 *);
+double genrand_real3(struct mt19937 *);
+double genrand_res53(struct mt19937 *);
+
+#endif
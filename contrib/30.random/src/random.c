@@ -2,22 +2,36 @@
 #include "picrin/extra.h"
 #include "picrin/lib.h"
 
-double genrand_real3(void);
+#include "mt19937ar.h"
+
+/*
+ * The generator state is a bytevector closed over by random-real, so
+ * that each interpreter has its own and an image saves it along with
+ * everything else.
+ */
 
 static pic_value
 pic_random_real(pic_state *pic)
 {
+  struct mt19937 *g = (struct mt19937 *) pic_blob(pic, pic_closure_ref(pic, 0), NULL);
+
   pic_get_args(pic, "");
 
-  return pic_float_value(pic, genrand_real3());
+  return pic_float_value(pic, genrand_real3(g));
 }
 
 void
 pic_nitro_init_random(pic_state *pic)
 {
+  pic_value state;
+
   pic_deflibrary(pic, "srfi.27");
   pic_in_library(pic, "srfi.27");
   pic_export(pic, 1, "random-real");
 
-  pic_defun(pic, "srfi.27:random-real", pic_random_real);
+  state = pic_blob_value(pic, NULL, sizeof(struct mt19937));
+  ((struct mt19937 *) pic_blob(pic, state, NULL))->mti = MT19937_N + 1;
+
+  pic_register_func(pic, "srfi.27:random-real", pic_random_real);
+  pic_define(pic, "srfi.27:random-real", pic_lambda(pic, pic_random_real, 1, state));
 }
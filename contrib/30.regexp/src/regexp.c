@@ -19,7 +19,7 @@ regexp_dtor(pic_state *pic, void *data)
   pic_free(pic, data);
 }
 
-static const pic_data_type regexp_type = { "regexp", regexp_dtor };
+static const pic_data_type regexp_type = { "regexp", regexp_dtor, NULL };
 
 static pic_value
 pic_regexp_regexp(pic_state *pic)
@@ -83,21 +83,24 @@ pic_regexp_regexp_match(pic_state *pic)
   pic_value str, matches, positions;
   int i, offset;
 
-  pic_get_args(pic, "uz", &reg, &regexp_type, &input);
+  pic_get_args(pic, "us", &reg, &regexp_type, &str);
+
+  input = pic_cstr(pic, str, NULL);
 
   matches = pic_nil_value(pic);
   positions = pic_nil_value(pic);
 
+  /* matched substrings share the buffer of the input string */
+
   if (strchr(reg->flags, 'g') != NULL) {
     /* global search */
 
     offset = 0;
-    while (regexec(&reg->reg, input, 1, match, 0) != REG_NOMATCH) {
-      pic_push(pic, pic_str_value(pic, input, match[0].rm_eo - match[0].rm_so), matches);
-      pic_push(pic, pic_int_value(pic, offset), positions);
+    while (regexec(&reg->reg, input + offset, 1, match, 0) != REG_NOMATCH) {
+      pic_push(pic, pic_str_sub(pic, str, offset + match[0].rm_so, offset + match[0].rm_eo), matches);
+      pic_push(pic, pic_int_value(pic, offset + match[0].rm_so), positions);
 
       offset += match[0].rm_eo;
-      input += match[0].rm_eo;
     }
   } else {
     /* local search */
@@ -107,8 +110,7 @@ pic_regexp_regexp_match(pic_state *pic)
         if (match[i].rm_so == -1) {
           break;
         }
-        str = pic_str_value(pic, input + match[i].rm_so, match[i].rm_eo - match[i].rm_so);
-        pic_push(pic, str, matches);
+        pic_push(pic, pic_str_sub(pic, str, match[i].rm_so, match[i].rm_eo), matches);
         pic_push(pic, pic_int_value(pic, match[i].rm_so), positions);
       }
     }
@@ -130,17 +132,20 @@ pic_regexp_regexp_split(pic_state *pic)
   struct pic_regexp_t *reg;
   const char *input;
   regmatch_t match;
-  pic_value output = pic_nil_value(pic);
+  pic_value str, output = pic_nil_value(pic);
+  int len, offset = 0;
 
-  pic_get_args(pic, "uz", &reg, &regexp_type, &input);
+  pic_get_args(pic, "us", &reg, &regexp_type, &str);
 
-  while (regexec(&reg->reg, input, 1, &match, 0) != REG_NOMATCH) {
-    pic_push(pic, pic_str_value(pic, input, match.rm_so), output);
+  input = pic_cstr(pic, str, &len);
 
-    input += match.rm_eo;
+  while (regexec(&reg->reg, input + offset, 1, &match, 0) != REG_NOMATCH) {
+    pic_push(pic, pic_str_sub(pic, str, offset, offset + match.rm_so), output);
+
+    offset += match.rm_eo;
   }
 
-  pic_push(pic, pic_cstr_value(pic, input), output);
+  pic_push(pic, pic_str_sub(pic, str, offset, len), output);
 
   return pic_reverse(pic, output);
 }
@@ -151,18 +156,21 @@ pic_regexp_regexp_replace(pic_state *pic)
   struct pic_regexp_t *reg;
   const char *input;
   regmatch_t match;
-  pic_value txt, output = pic_lit_value(pic, "");
+  pic_value str, txt, output = pic_lit_value(pic, "");
+  int len, offset = 0;
+
+  pic_get_args(pic, "uss", &reg, &regexp_type, &str, &txt);
 
-  pic_get_args(pic, "uzs", &reg, &regexp_type, &input, &txt);
+  input = pic_cstr(pic, str, &len);
 
-  while (regexec(&reg->reg, input, 1, &match, 0) != REG_NOMATCH) {
-    output = pic_str_cat(pic, output, pic_str_value(pic, input, match.rm_so));
+  while (regexec(&reg->reg, input + offset, 1, &match, 0) != REG_NOMATCH) {
+    output = pic_str_cat(pic, output, pic_str_sub(pic, str, offset, offset + match.rm_so));
     output = pic_str_cat(pic, output, txt);
 
-    input += match.rm_eo;
+    offset += match.rm_eo;
   }
 
-  return pic_str_cat(pic, output, pic_str_value(pic, input, strlen(input)));
+  return pic_str_cat(pic, output, pic_str_sub(pic, str, offset, len));
 }
 
 void
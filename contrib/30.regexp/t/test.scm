@@ -7,6 +7,7 @@
  (test-values (values '("abcd" "b") '(5 6)) (regexp-match (regexp "a(b)cd") "abdacabcd"))
 (test '("a" "b" "c" "d") (regexp-split (regexp ",") "a,b,c,d"))
 (test '("a" "b" "c" "d") (regexp-split (regexp "\\.+") "a.b....c.....d"))
+(test '("" "b" "cd") (regexp-split (regexp "x") (string-copy "abxbxcd" 2)))
 (test "a b c d" (regexp-replace (regexp ",") "a,b,c,d" " "))
 (test "newline tab space " (regexp-replace (regexp "[\n\t ]") "newline
 tab	space " " "))
@@ -9,9 +9,11 @@ CONTRIB_LIBS += \
 	contrib/40.srfi/srfi/26.scm\
 	contrib/40.srfi/srfi/43.scm\
 	contrib/40.srfi/srfi/60.scm\
+	contrib/40.srfi/srfi/69.scm\
 	contrib/40.srfi/srfi/95.scm\
 	contrib/40.srfi/srfi/106.scm\
-	contrib/40.srfi/srfi/111.scm
+	contrib/40.srfi/srfi/111.scm\
+	contrib/40.srfi/srfi/125.scm
 CONTRIB_SRCS += \
 	contrib/40.srfi/src/0.c\
 	contrib/40.srfi/src/106.c
@@ -10,7 +10,9 @@ pic_nitro_init_srfi_0(pic_state *pic)
     pic_add_feature(pic, "srfi-26");
     pic_add_feature(pic, "srfi-43");
     pic_add_feature(pic, "srfi-60");
+    pic_add_feature(pic, "srfi-69");
     pic_add_feature(pic, "srfi-95");
     pic_add_feature(pic, "srfi-106");
     pic_add_feature(pic, "srfi-111");
+    pic_add_feature(pic, "srfi-125");
 }
@@ -0,0 +1,204 @@
+(define-library (srfi 125)
+  (import (scheme base)
+          (except (srfi 69) hash-table-fold)
+          (only (picrin base)
+                hash-table-contains?
+                hash-table-clear!)
+          (rename (only (picrin base) hash-table-fold)
+                  (hash-table-fold %hash-table-fold)))
+
+  ;; constructors
+
+  (define (hash-table equal . args)
+    (let ((table (make-hash-table equal)))
+      (let loop ((args args))
+        (if (null? args)
+            table
+            (begin
+              (hash-table-set! table (car args) (cadr args))
+              (loop (cddr args)))))))
+
+  (define (hash-table-unfold stop? mapper successor seed equal . rest)
+    (let ((table (apply make-hash-table equal rest)))
+      (let loop ((seed seed))
+        (if (stop? seed)
+            table
+            (call-with-values (lambda () (mapper seed))
+              (lambda (key value)
+                (hash-table-set! table key value)
+                (loop (successor seed))))))))
+
+  ;; predicates
+
+  (define (hash-table-empty? table)
+    (zero? (hash-table-size table)))
+
+  (define (hash-table-mutable? table)
+    (hash-table? table))
+
+  (define (hash-table=? value= table1 table2)
+    (and (= (hash-table-size table1) (hash-table-size table2))
+         (%hash-table-fold table1
+                           (lambda (key value acc)
+                             (and acc
+                                  (hash-table-contains? table2 key)
+                                  (value= value (hash-table-ref table2 key))))
+                           #t)))
+
+  ;; mutators
+
+  (define (hash-table-intern! table key failure)
+    (hash-table-ref table key
+                    (lambda ()
+                      (let ((value (failure)))
+                        (hash-table-set! table key value)
+                        value))))
+
+  (define (hash-table-pop! table)
+    (let ((entry (call/cc
+                  (lambda (return)
+                    (hash-table-walk table
+                      (lambda (key value)
+                        (return (cons key value))))
+                    #f))))
+      (unless entry
+        (error "hash-table-pop!: table is empty" table))
+      (hash-table-delete! table (car entry))
+      (values (car entry) (cdr entry))))
+
+  ;; whole hash table
+
+  (define (hash-table-entries table)
+    (values (hash-table-keys table) (hash-table-values table)))
+
+  (define (hash-table-find proc table failure)
+    (call/cc
+     (lambda (return)
+       (hash-table-walk table
+         (lambda (key value)
+           (let ((x (proc key value)))
+             (when x
+               (return x)))))
+       (failure))))
+
+  (define (hash-table-count pred table)
+    (%hash-table-fold table
+                      (lambda (key value n)
+                        (if (pred key value) (+ n 1) n))
+                      0))
+
+  ;; mapping and folding
+
+  (define (hash-table-map proc equal table)
+    (let ((result (make-hash-table equal)))
+      (hash-table-walk table
+        (lambda (key value)
+          (hash-table-set! result key (proc value))))
+      result))
+
+  (define (hash-table-for-each proc table)
+    (if (hash-table? proc)
+        (hash-table-walk proc table)    ; deprecated argument order
+        (hash-table-walk table proc)))
+
+  (define (hash-table-map! proc table)
+    (for-each (lambda (key)
+                (hash-table-set! table key (proc key (hash-table-ref table key))))
+              (hash-table-keys table)))
+
+  (define (hash-table-map->list proc table)
+    (%hash-table-fold table
+                      (lambda (key value acc)
+                        (cons (proc key value) acc))
+                      '()))
+
+  (define (hash-table-fold proc seed table)
+    (if (hash-table? proc)
+        (%hash-table-fold proc seed table) ; deprecated argument order
+        (%hash-table-fold table proc seed)))
+
+  (define (hash-table-prune! proc table)
+    (hash-table-walk (hash-table-copy table)
+      (lambda (key value)
+        (when (proc key value)
+          (hash-table-delete! table key)))))
+
+  ;; copying and conversion
+
+  (define (hash-table-empty-copy table)
+    (make-hash-table (hash-table-equivalence-function table)
+                     (hash-table-hash-function table)))
+
+  ;; hash tables as sets
+
+  (define (hash-table-union! table1 table2)
+    (hash-table-walk table2
+      (lambda (key value)
+        (unless (hash-table-contains? table1 key)
+          (hash-table-set! table1 key value))))
+    table1)
+
+  (define (hash-table-intersection! table1 table2)
+    (hash-table-prune! (lambda (key value)
+                         (not (hash-table-contains? table2 key)))
+                       table1)
+    table1)
+
+  (define (hash-table-difference! table1 table2)
+    (hash-table-prune! (lambda (key value)
+                         (hash-table-contains? table2 key))
+                       table1)
+    table1)
+
+  (define (hash-table-xor! table1 table2)
+    (hash-table-walk table2
+      (lambda (key value)
+        (if (hash-table-contains? table1 key)
+            (hash-table-delete! table1 key)
+            (hash-table-set! table1 key value))))
+    table1)
+
+  (export make-hash-table
+          hash-table
+          hash-table-unfold
+          alist->hash-table
+          hash-table?
+          hash-table-contains?
+          hash-table-exists?
+          hash-table-empty?
+          hash-table=?
+          hash-table-mutable?
+          hash-table-ref
+          hash-table-ref/default
+          hash-table-set!
+          hash-table-delete!
+          hash-table-intern!
+          hash-table-update!
+          hash-table-update!/default
+          hash-table-pop!
+          hash-table-clear!
+          hash-table-size
+          hash-table-keys
+          hash-table-values
+          hash-table-entries
+          hash-table-find
+          hash-table-count
+          hash-table-map
+          hash-table-for-each
+          hash-table-walk
+          hash-table-map!
+          hash-table-map->list
+          hash-table-fold
+          hash-table-prune!
+          hash-table-copy
+          hash-table-empty-copy
+          hash-table->alist
+          hash-table-union!
+          hash-table-intersection!
+          hash-table-difference!
+          hash-table-xor!
+          hash
+          string-hash
+          string-ci-hash
+          hash-table-equivalence-function
+          hash-table-hash-function))
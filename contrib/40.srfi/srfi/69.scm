@@ -0,0 +1,44 @@
+(define-library (srfi 69)
+  (import (scheme base)
+          (picrin base))
+
+  ;; hash tables are built in; only the derived procedures live here
+
+  (define (char-ascii-downcase c)
+    (if (char<=? #\A c #\Z)
+        (integer->char (+ (char->integer c) 32))
+        c))
+
+  (define (string-ci-hash s . bound)
+    (apply string-hash (string-map char-ascii-downcase s) bound))
+
+  (define (hash-table-merge! table1 table2)
+    (hash-table-walk table2
+      (lambda (key value)
+        (hash-table-set! table1 key value)))
+    table1)
+
+  (export make-hash-table
+          hash-table?
+          alist->hash-table
+          hash-table-equivalence-function
+          hash-table-hash-function
+          hash-table-ref
+          hash-table-ref/default
+          hash-table-set!
+          hash-table-delete!
+          hash-table-exists?
+          hash-table-update!
+          hash-table-update!/default
+          hash-table-size
+          hash-table-keys
+          hash-table-values
+          hash-table-walk
+          hash-table-fold
+          hash-table->alist
+          hash-table-copy
+          hash-table-merge!
+          hash
+          string-hash
+          string-ci-hash
+          hash-by-identity))
@@ -52,7 +52,8 @@
 ; (test #0=(z q . #0#) (circular-list 'z 'q))
 
 (test '(0 1 2 3 4) (iota 5))
-(test '(0 -0.1 -0.2 -0.3 -0.4) (iota 5 0 -0.1))
+;; the elements are start + i * step; 3 * -0.1 is not the double nearest -0.3
+(test (list 0 -0.1 -0.2 (* 3 -0.1) -0.4) (iota 5 0 -0.1))
 
 ; TODO: Test proper-list?
 ; TODO: Test circular-list?
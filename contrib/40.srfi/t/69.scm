@@ -0,0 +1,54 @@
+(import (scheme base)
+        (scheme write)
+        (srfi 69)
+        (picrin test))
+
+(test-begin)
+
+(define h (make-hash-table))
+(hash-table-set! h '(1 2) 'a)
+(hash-table-set! h "str" 'b)
+(test 'a (hash-table-ref h (list 1 2)))
+(test 'b (hash-table-ref/default h (string-copy "str") #f))
+(test 'none (hash-table-ref h 'missing (lambda () 'none)))
+(test 2 (hash-table-size h))
+(hash-table-delete! h "str")
+(test #f (hash-table-exists? h "str"))
+
+(define e (make-hash-table eq?))
+(let loop ((i 0))
+  (when (< i 10000)
+    (hash-table-set! e i (* i i))
+    (loop (+ i 1))))
+(test 10000 (hash-table-size e))
+(test (* 9999 9999) (hash-table-ref e 9999))
+(test 10000 (hash-table-fold e (lambda (k v n) (+ n 1)) 0))
+
+(hash-table-update! e 3 (lambda (x) (+ x 1)))
+(test 10 (hash-table-ref e 3))
+(hash-table-update!/default e -1 (lambda (x) (cons 'x x)) '())
+(test '(x) (hash-table-ref e -1))
+
+(define s (make-hash-table string=?))
+(hash-table-set! s "abc" 1)
+(test 1 (hash-table-ref s (string-append "a" "bc")))
+
+(define m (make-hash-table (lambda (a b) (= (modulo a 10) (modulo b 10)))
+                           (lambda (a . bound) (modulo a 10))))
+(hash-table-set! m 13 'x)
+(test 'x (hash-table-ref m 23))
+
+(define a (alist->hash-table '((a . 1) (b . 2) (a . 3)) eq?))
+(test 1 (hash-table-ref a 'a))
+(test 3 (apply + (hash-table-values a)))
+(test 2 (hash-table-size (hash-table-copy a)))
+(test eq? (hash-table-equivalence-function a))
+(test "#<hash-table eqv? (1 . one)>"
+      (let ((out (open-output-string)))
+        (write (alist->hash-table '((1 . one)) eqv?) out)
+        (get-output-string out)))
+
+(test (hash "abc") (hash (string-copy "abc")))
+(test (string-hash "abc" 7) (string-ci-hash "ABC" 7))
+
+(test-end)
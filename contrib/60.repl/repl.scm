@@ -19,8 +19,16 @@
       (define (add-history str)
         #f))))
 
+  ;; set once the imports are done, which an image saved afterwards keeps
+  (define env-ready #f)
+
   (define (init-env)
     (current-library '(picrin user))
+    (unless env-ready
+      (init-imports)
+      (set! env-ready #t)))
+
+  (define (init-imports)
     (eval
      '(import (picrin base)
               (scheme base)
@@ -37,7 +45,7 @@
               (scheme r5rs)
               (picrin pretty-print)
               (picrin macro))
-     '(picrin user)))
+     (library-environment '(picrin user))))
 
   (define (repeat x)
     (let ((p (list x)))
@@ -92,17 +100,18 @@
                           (write condition)
                           (newline)
                           (set! str "")))
-                    (exit))
+                    (exit #f))
                   (lambda ()
                     (call-with-port (open-input-string str)
                       (lambda (port)
                         (let next ((expr (read port)))
                           (unless (eof-object? expr)
-                            (write (eval expr))
+                            (write (eval expr (library-environment '(picrin user))))
                             (newline)
                             (set! str "")
                             (next (read port))))))))))
               (loop str))))))
 
-  (export repl))
+  (export repl
+          init-env))
 
@@ -5,6 +5,7 @@
           (scheme process-context)
           (scheme load)
           (scheme eval)
+          (only (picrin base) library-environment)
           (picrin repl))
 
   (define (print-help)
@@ -36,12 +37,14 @@
     (load filename))
 
   (define (exec-line str)
-    (call-with-port (open-input-string str)
-      (lambda (in)
-        (let loop ((expr (read in)))
-          (unless (eof-object? expr)
-            (eval expr '(picrin user))
-            (loop (read in)))))))
+    (init-env)
+    (let ((env (library-environment '(picrin user))))
+      (call-with-port (open-input-string str)
+        (lambda (in)
+          (let loop ((expr (read in)))
+            (unless (eof-object? expr)
+              (eval expr env)
+              (loop (read in))))))))
 
   (define (main)
     (call-with-values getopt
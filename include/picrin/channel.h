@@ -0,0 +1,29 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#ifndef PICRIN_CHANNEL_H
+#define PICRIN_CHANNEL_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * channels between states, see contrib/30.channel
+ */
+
+struct pic_channel;
+
+pic_value pic_make_channel(pic_state *);
+struct pic_channel *pic_channel_ptr(pic_state *, pic_value ch);
+pic_value pic_channel_value(pic_state *, struct pic_channel *);
+
+/* called by a sender when a message arrives at an empty channel */
+void pic_channel_notify(struct pic_channel *, void (*notify)(void *), void *arg);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
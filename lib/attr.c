@@ -48,6 +48,12 @@ pic_make_attr(pic_state *pic)
   return pic_lambda(pic, attr_call, 1, obj_value(pic, attr));
 }
 
+bool
+pic_attr_proc_p(pic_state *pic, pic_value proc)
+{
+  return pic_proc_func_p(pic, proc) && proc_ptr(pic, proc)->u.func == attr_call;
+}
+
 pic_value
 pic_attr_ref(pic_state *pic, pic_value attr, pic_value key)
 {
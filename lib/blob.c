@@ -3,214 +3,1324 @@
  */
 
 #include <picrin.h>
+#include <picrin/extra.h>
 #include "value.h"
 #include "object.h"
+#include "state.h"
+
+/*
+ * fasl
+ *
+ * "\x7f" "fsl", a version byte, the symbol table, then one object. Counts
+ * and lengths are LEB128 varints, fixnums are zigzag varints, and floats
+ * are 8 bytes in little-endian order. The symbol table is a count and the
+ * names, and a symbol in the object is its index there. An object that is
+ * reached more than once is written after FASL_DEF on first sight and
+ * as FASL_REF afterwards, so sharing and cycles survive a round trip.
+ *
+ * A nested irep that has no labels or external objects in it is written
+ * after FASL_LAZY and its length. The reader skips over it and decodes it
+ * when a closure is first made of it (see pic_force_irep), so that code
+ * which never runs costs little more than its bytes.
+ *
+ * The writer may be given a procedure that names objects living outside
+ * the stream: for any record, procedure or other opaque object it returns
+ * a key, or #f to have the object written out. Such an object is written
+ * as FASL_EXTERN and its key, and the reader's resolver procedure maps the
+ * key back to an object of the loading state.
+ *
+ * A procedure written in C is written as the name its function was
+ * registered under (see pic_register_func) and the variables it closes
+ * over; the reader looks the name up in its own state.
+ *
+ * A record type is written with a number the writing state gives it
+ * (see pic->rectypes), so that reading it back in the same state yields
+ * the type itself rather than a fresh one its predicate and accessors
+ * would not accept. Elsewhere the number means nothing, and a new type
+ * is made unless one with that number has the same name and fields.
+ */
 
-static void dump1(unsigned char c, unsigned char *buf, int *len) {
-  if (buf) {
-    buf[*len] = c;
+#define FASL_VERSION 3
+
+enum {
+  FASL_NIL,
+  FASL_TRUE,
+  FASL_FALSE,
+  FASL_UNDEF,
+  FASL_EOF,
+  FASL_INT,                     /* zigzag */
+  FASL_FLOAT,                   /* 8 bytes */
+  FASL_CHAR,                    /* 1 byte */
+  FASL_STRING,                  /* len bytes */
+  FASL_BLOB,                    /* len bytes */
+  FASL_SYMBOL,                  /* index */
+  FASL_LIST,                    /* n car... cdr */
+  FASL_VECTOR,                  /* n obj... */
+  FASL_DICT,                    /* n (sym obj)... */
+  FASL_TABLE,                   /* kind n (key obj)... */
+  FASL_RECTYPE,                 /* uid name fields */
+  FASL_RECORD,                  /* type slot... */
+  FASL_IREP,                    /* argc flags frame_size objc irepc codec obj... code irep... */
+  FASL_FRAME,                   /* regc up reg... */
+  FASL_PROC,                    /* irep env */
+  FASL_DEF,                     /* label obj */
+  FASL_REF,                     /* label */
+  FASL_INVALID,                 /* unassigned frame register */
+  FASL_EXTERN,                  /* key */
+  FASL_ATTR,                    /* n (key obj)... */
+  FASL_FUNC,                    /* name env */
+  FASL_LAZY                     /* len irep */
+};
+
+#define IREP_FLAGS_MASK (IREP_VARG)
+
+/* values in dumper.seen */
+#define SEEN_ONCE 0
+#define SEEN_SHARED 1
+#define SEEN_LABEL(n) ((n) + 2)
+
+struct dumper {
+  pic_value blob;               /* output, grown in place */
+  unsigned char *buf;
+  int len, capa;
+  pic_value seen;               /* eq table: object -> SEEN_* */
+  pic_value syms;               /* dictionary: symbol -> index */
+  pic_value extern_proc;        /* #f or object -> key */
+  pic_value externs;            /* eq table: object -> key */
+  int nlabels, nsyms;
+  int nrefs;                    /* FASL_DEF, FASL_REF and FASL_EXTERN written */
+};
+
+static void
+dump_reserve(pic_state *pic, struct dumper *d, int n)
+{
+  struct blob *bv;
+
+  if (d->len + n > d->capa) {
+    while (d->len + n > d->capa) {
+      d->capa *= 2;
+    }
+    bv = blob_ptr(pic, d->blob);
+    bv->data = d->buf = pic_realloc(pic, bv->data, d->capa);
+    bv->len = d->capa;
   }
-  *len = *len + 1;
 }
 
-static void dump4(unsigned long n, unsigned char *buf, int *len) {
-  assert(sizeof(long) * CHAR_BIT <= 32 || n <= 0xfffffffful);
+static void
+dump_bytes(pic_state *pic, struct dumper *d, const void *ptr, int n)
+{
+  dump_reserve(pic, d, n);
+  memcpy(d->buf + d->len, ptr, n);
+  d->len += n;
+}
 
-  dump1((n & 0xff), buf, len);
-  dump1((n & 0xff00) >> 8, buf, len);
-  dump1((n & 0xff0000) >> 16, buf, len);
-  dump1((n & 0xff000000) >> 24, buf, len);
+static void
+dump_tag(pic_state *pic, struct dumper *d, int tag)
+{
+  dump_reserve(pic, d, 1);
+  d->buf[d->len++] = tag;
 }
 
-static void dump_obj(pic_state *pic, pic_value obj, unsigned char *buf, int *len);
+static void
+dump_uint(pic_state *pic, struct dumper *d, unsigned long n)
+{
+  dump_reserve(pic, d, sizeof(long) * CHAR_BIT / 7 + 1);
+  while (n >= 0x80) {
+    d->buf[d->len++] = (n & 0x7f) | 0x80;
+    n >>= 7;
+  }
+  d->buf[d->len++] = n;
+}
 
-#define IREP_FLAGS_MASK (IREP_VARG)
+static void
+dump_float(pic_state *pic, struct dumper *d, double f)
+{
+  static const int one = 1;
+  union { double f; unsigned char b[8]; } u;
+  int i;
+
+  u.f = f;
+  dump_reserve(pic, d, 8);
+  for (i = 0; i < 8; ++i) {
+    d->buf[d->len++] = u.b[*(const char *) &one ? i : 7 - i];
+  }
+}
+
+static bool
+shareable_p(pic_state *pic, pic_value obj)
+{
+  return pic_obj_p(pic, obj) && ! pic_sym_p(pic, obj);
+}
+
+static bool
+external_p(pic_state *pic, struct dumper *d, pic_value obj)
+{
+  pic_value key;
+
+  if (pic_false_p(pic, d->extern_proc)) {
+    return false;
+  }
+  switch (pic_type(pic, obj)) {
+  case PIC_TYPE_PAIR:
+  case PIC_TYPE_VECTOR:
+  case PIC_TYPE_STRING:
+  case PIC_TYPE_BLOB:
+  case PIC_TYPE_FRAME:
+  case PIC_TYPE_IREP:
+    return false;
+  default:
+    break;
+  }
+  key = pic_call(pic, d->extern_proc, 1, obj);
+  if (pic_false_p(pic, key)) {
+    return false;
+  }
+  pic_table_set(pic, d->externs, obj, key);
+  return true;
+}
+
+/* first pass: find the objects reached more than once */
+static void scan_irep(pic_state *pic, struct dumper *d, struct irep *irep);
+
+static bool
+scan_enter(pic_state *pic, struct dumper *d, struct object *ptr)
+{
+  pic_value obj = obj_value(pic, ptr);
+
+  if (pic_table_has(pic, d->seen, obj)) {
+    pic_table_set(pic, d->seen, obj, pic_int_value(pic, SEEN_SHARED));
+    return false;
+  }
+  pic_table_set(pic, d->seen, obj, pic_int_value(pic, SEEN_ONCE));
+  return true;
+}
 
 static void
-dump_irep(pic_state *pic, struct irep *irep, unsigned char *buf, int *len)
-{
-  size_t i;
-  dump1(irep->argc, buf, len);
-  dump1(irep->flags & IREP_FLAGS_MASK, buf, len);
-  dump1(irep->frame_size, buf, len);
-  dump1(irep->irepc, buf, len);
-  dump1(irep->objc, buf, len);
-  dump4(irep->codec, buf, len);
+scan_obj(pic_state *pic, struct dumper *d, pic_value obj)
+{
+  int i;
+
+ loop:
+  if (! shareable_p(pic, obj) || ! scan_enter(pic, d, pic_ptr(pic, obj))) {
+    return;
+  }
+  if (external_p(pic, d, obj)) {
+    obj = pic_table_ref(pic, d->externs, obj);
+    goto loop;
+  }
+  switch (pic_type(pic, obj)) {
+  case PIC_TYPE_PAIR:
+    scan_obj(pic, d, pic_car(pic, obj));
+    obj = pic_cdr(pic, obj);
+    goto loop;
+  case PIC_TYPE_VECTOR:
+    for (i = 0; i < vec_ptr(pic, obj)->len; ++i) {
+      scan_obj(pic, d, vec_ptr(pic, obj)->data[i]);
+    }
+    break;
+  case PIC_TYPE_DICT: {
+    pic_value val;
+    int it = 0;
+    while (pic_dict_next(pic, obj, &it, NULL, &val)) {
+      scan_obj(pic, d, val);
+    }
+    break;
+  }
+  case PIC_TYPE_TABLE: {
+    pic_value key, val;
+    int it = 0;
+    while (pic_table_next(pic, obj, &it, &key, &val)) {
+      scan_obj(pic, d, key);
+      scan_obj(pic, d, val);
+    }
+    break;
+  }
+  case PIC_TYPE_RECORD_TYPE:
+    scan_obj(pic, d, rectype_ptr(pic, obj)->fields);
+    break;
+  case PIC_TYPE_RECORD: {
+    struct record *rec = rec_ptr(pic, obj);
+    scan_obj(pic, d, obj_value(pic, rec->type));
+    for (i = 0; i < rec->type->nfields; ++i) {
+      scan_obj(pic, d, rec->slots[i]);
+    }
+    break;
+  }
+  case PIC_TYPE_PROC_IREP: {
+    struct proc *proc = proc_ptr(pic, obj);
+    scan_irep(pic, d, proc->u.irep);
+    if (proc->env) {
+      obj = obj_value(pic, proc->env);
+      goto loop;
+    }
+    break;
+  }
+  case PIC_TYPE_PROC_FUNC: {
+    khash_t(attr) *h;
+    int it;
+    if (! pic_attr_proc_p(pic, obj)) {
+      if (proc_ptr(pic, obj)->env) {
+        obj = obj_value(pic, proc_ptr(pic, obj)->env);
+        goto loop;
+      }
+      break;
+    }
+    h = &attr_ptr(pic, proc_ptr(pic, obj)->env->regs[0])->hash;
+    for (it = kh_begin(h); it != kh_end(h); ++it) {
+      if (kh_exist(h, it)) {
+        scan_obj(pic, d, obj_value(pic, kh_key(h, it)));
+        scan_obj(pic, d, kh_val(h, it));
+      }
+    }
+    break;
+  }
+  case PIC_TYPE_FRAME: {
+    struct frame *fp = (struct frame *) pic_ptr(pic, obj);
+    for (i = 0; i < fp->regc; ++i) {
+      scan_obj(pic, d, fp->regs[i]);
+    }
+    if (fp->up) {
+      obj = obj_value(pic, fp->up);
+      goto loop;
+    }
+    break;
+  }
+  }
+}
+
+static void
+scan_irep(pic_state *pic, struct dumper *d, struct irep *irep)
+{
+  int i;
+
+  if (! scan_enter(pic, d, (struct object *) irep)) {
+    return;
+  }
+  if (irep->flags & IREP_LAZY) {
+    pic_force_irep(pic, irep);
+  }
   for (i = 0; i < irep->objc; ++i) {
-    dump_obj(pic, irep->obj[i], buf, len);
+    scan_obj(pic, d, irep->obj[i]);
+  }
+  for (i = 0; i < irep->irepc; ++i) {
+    scan_irep(pic, d, irep->irep[i]);
+  }
+}
+
+/* second pass */
+static void dump_obj(pic_state *pic, struct dumper *d, pic_value obj);
+
+/* writes FASL_REF and returns false if obj has been written already */
+static bool
+dump_label(pic_state *pic, struct dumper *d, struct object *ptr)
+{
+  pic_value obj = obj_value(pic, ptr);
+  int seen = pic_int(pic, pic_table_ref(pic, d->seen, obj));
+
+  switch (seen) {
+  case SEEN_ONCE:
+    return true;
+  case SEEN_SHARED:
+    pic_table_set(pic, d->seen, obj, pic_int_value(pic, SEEN_LABEL(d->nlabels)));
+    dump_tag(pic, d, FASL_DEF);
+    dump_uint(pic, d, d->nlabels++);
+    d->nrefs++;
+    return true;
+  default:
+    dump_tag(pic, d, FASL_REF);
+    d->nrefs++;
+    dump_uint(pic, d, seen - SEEN_LABEL(0));
+    return false;
+  }
+}
+
+static void dump_irep(pic_state *pic, struct dumper *d, struct irep *irep);
+
+static void
+dump_child_irep(pic_state *pic, struct dumper *d, struct irep *irep)
+{
+  unsigned char head[sizeof(long) * CHAR_BIT / 7 + 2];
+  int start = d->len, nrefs = d->nrefs, len, n = 0;
+  unsigned long u;
+
+  dump_irep(pic, d, irep);
+  if (d->nrefs != nrefs) {
+    return;
+  }
+
+  /* self-contained: put FASL_LAZY and the length in front */
+  len = d->len - start;
+  head[n++] = FASL_LAZY;
+  for (u = len; u >= 0x80; u >>= 7) {
+    head[n++] = (u & 0x7f) | 0x80;
+  }
+  head[n++] = u;
+  dump_reserve(pic, d, n);
+  memmove(d->buf + start + n, d->buf + start, len);
+  memcpy(d->buf + start, head, n);
+  d->len += n;
+}
+
+static void
+dump_irep(pic_state *pic, struct dumper *d, struct irep *irep)
+{
+  int i;
+
+  if (! dump_label(pic, d, (struct object *) irep)) {
+    return;
   }
-  for (i = 0; i < irep->codec; ++i) {
-    dump1(irep->code[i], buf, len);
+  dump_tag(pic, d, FASL_IREP);
+  dump_uint(pic, d, irep->argc);
+  dump_uint(pic, d, irep->flags & IREP_FLAGS_MASK);
+  dump_uint(pic, d, irep->frame_size);
+  dump_uint(pic, d, irep->objc);
+  dump_uint(pic, d, irep->irepc);
+  dump_uint(pic, d, irep->codec);
+  for (i = 0; i < irep->objc; ++i) {
+    dump_obj(pic, d, irep->obj[i]);
   }
+  dump_bytes(pic, d, irep->code, irep->codec);
   for (i = 0; i < irep->irepc; ++i) {
-    dump_irep(pic, irep->irep[i], buf, len);
+    dump_child_irep(pic, d, irep->irep[i]);
   }
 }
 
 static void
-dump_obj(pic_state *pic, pic_value obj, unsigned char *buf, int *len)
-{
-  if (pic_int_p(pic, obj)) {
-    dump1(0x00, buf, len);
-    dump4(pic_int(pic, obj), buf, len);
-  } else if (pic_str_p(pic, obj)) {
-    int l, i;
-    const char *str = pic_str(pic, obj, &l);
-    dump1(0x01, buf, len);
-    dump4(l, buf, len);
-    for (i = 0; i < l; ++i) {
-      dump1(str[i], buf, len);
-    }
-    dump1(0, buf, len);
-  } else if (pic_sym_p(pic, obj)) {
-    int l, i;
-    const char *str = pic_str(pic, pic_sym_name(pic, obj), &l);
-    dump1(0x02, buf, len);
-    dump4(l, buf, len);
-    for (i = 0; i < l; ++i) {
-      dump1(str[i], buf, len);
-    }
-    dump1(0, buf, len);
-  } else if (pic_proc_p(pic, obj)) {
-    if (pic_proc_func_p(pic, obj)) {
-      pic_error(pic, "dump: c function procedure serialization unsupported", 1, obj);
-    }
-    if (proc_ptr(pic, obj)->env) {
-      pic_error(pic, "dump: local procedure serialization unsupported", 1, obj);
-    }
-    dump1(0x03, buf, len);
-    dump_irep(pic, proc_ptr(pic, obj)->u.irep, buf, len);
-  } else if (pic_char_p(pic, obj)) {
-    dump1(0x04, buf, len);
-    dump1(pic_char(pic, obj), buf, len);
-  } else {
-    pic_error(pic, "dump: unsupported object", 1, obj);
+dump_sym(pic_state *pic, struct dumper *d, pic_value sym)
+{
+  if (! pic_dict_has(pic, d->syms, sym)) {
+    pic_dict_set(pic, d->syms, sym, pic_int_value(pic, d->nsyms++));
+  }
+  dump_tag(pic, d, FASL_SYMBOL);
+  dump_uint(pic, d, pic_int(pic, pic_dict_ref(pic, d->syms, sym)));
+}
+
+static int
+rectype_uid(pic_state *pic, pic_value type)
+{
+  if (! pic_attr_has(pic, pic->rectypes, type)) {
+    pic_attr_set(pic, pic->rectypes, type, pic_int_value(pic, ++pic->rectype_uid));
+  }
+  return pic_int(pic, pic_attr_ref(pic, pic->rectypes, type));
+}
+
+static void
+dump_obj(pic_state *pic, struct dumper *d, pic_value obj)
+{
+  int i, n;
+
+  if (shareable_p(pic, obj)) {
+    if (! dump_label(pic, d, pic_ptr(pic, obj))) {
+      return;
+    }
+    if (pic_table_has(pic, d->externs, obj)) {
+      dump_tag(pic, d, FASL_EXTERN);
+      d->nrefs++;
+      dump_obj(pic, d, pic_table_ref(pic, d->externs, obj));
+      return;
+    }
+  }
+
+  switch (pic_type(pic, obj)) {
+  case PIC_TYPE_NIL:
+    dump_tag(pic, d, FASL_NIL);
+    break;
+  case PIC_TYPE_TRUE:
+    dump_tag(pic, d, FASL_TRUE);
+    break;
+  case PIC_TYPE_FALSE:
+    dump_tag(pic, d, FASL_FALSE);
+    break;
+  case PIC_TYPE_UNDEF:
+    dump_tag(pic, d, FASL_UNDEF);
+    break;
+  case PIC_TYPE_EOF:
+    dump_tag(pic, d, FASL_EOF);
+    break;
+  case PIC_TYPE_INVALID:
+    dump_tag(pic, d, FASL_INVALID);
+    break;
+  case PIC_TYPE_INT:
+    n = pic_int(pic, obj);
+    dump_tag(pic, d, FASL_INT);
+    dump_uint(pic, d, n < 0 ? ~((unsigned long) n << 1) : (unsigned long) n << 1);
+    break;
+  case PIC_TYPE_FLOAT:
+    dump_tag(pic, d, FASL_FLOAT);
+    dump_float(pic, d, pic_float(pic, obj));
+    break;
+  case PIC_TYPE_CHAR:
+    dump_tag(pic, d, FASL_CHAR);
+    dump_tag(pic, d, (unsigned char) pic_char(pic, obj));
+    break;
+  case PIC_TYPE_STRING: {
+    const char *str = pic_str(pic, obj, &n);
+    dump_tag(pic, d, FASL_STRING);
+    dump_uint(pic, d, n);
+    dump_bytes(pic, d, str, n);
+    break;
+  }
+  case PIC_TYPE_BLOB: {
+    const unsigned char *buf = pic_blob(pic, obj, &n);
+    dump_tag(pic, d, FASL_BLOB);
+    dump_uint(pic, d, n);
+    dump_bytes(pic, d, buf, n);
+    break;
+  }
+  case PIC_TYPE_SYMBOL:
+    dump_sym(pic, d, obj);
+    break;
+  case PIC_TYPE_PAIR: {
+    pic_value rest = pic_cdr(pic, obj);
+
+    /* the spine runs on as long as no other reference points into it */
+    n = 1;
+    while (pic_pair_p(pic, rest)) {
+      if (pic_int(pic, pic_table_ref(pic, d->seen, rest)) != SEEN_ONCE) {
+        break;
+      }
+      n++;
+      rest = pic_cdr(pic, rest);
+    }
+    dump_tag(pic, d, FASL_LIST);
+    dump_uint(pic, d, n);
+    for (i = 0; i < n; ++i) {
+      dump_obj(pic, d, pic_car(pic, obj));
+      obj = pic_cdr(pic, obj);
+    }
+    dump_obj(pic, d, rest);
+    break;
+  }
+  case PIC_TYPE_VECTOR: {
+    struct vector *vec = vec_ptr(pic, obj);
+    dump_tag(pic, d, FASL_VECTOR);
+    dump_uint(pic, d, vec->len);
+    for (i = 0; i < vec->len; ++i) {
+      dump_obj(pic, d, vec->data[i]);
+    }
+    break;
+  }
+  case PIC_TYPE_DICT: {
+    pic_value key, val;
+    int it = 0;
+    dump_tag(pic, d, FASL_DICT);
+    dump_uint(pic, d, pic_dict_size(pic, obj));
+    while (pic_dict_next(pic, obj, &it, &key, &val)) {
+      dump_sym(pic, d, key);
+      dump_obj(pic, d, val);
+    }
+    break;
+  }
+  case PIC_TYPE_TABLE: {
+    pic_value key, val;
+    int it = 0;
+    if (table_ptr(pic, obj)->kind > PIC_TABLE_STRING) {
+      pic_error(pic, "fasl: hash table with a user-defined equivalence", 1, obj);
+    }
+    dump_tag(pic, d, FASL_TABLE);
+    dump_uint(pic, d, table_ptr(pic, obj)->kind);
+    dump_uint(pic, d, pic_table_size(pic, obj));
+    while (pic_table_next(pic, obj, &it, &key, &val)) {
+      dump_obj(pic, d, key);
+      dump_obj(pic, d, val);
+    }
+    break;
+  }
+  case PIC_TYPE_RECORD_TYPE:
+    dump_tag(pic, d, FASL_RECTYPE);
+    dump_uint(pic, d, rectype_uid(pic, obj));
+    dump_sym(pic, d, obj_value(pic, rectype_ptr(pic, obj)->name));
+    dump_obj(pic, d, rectype_ptr(pic, obj)->fields);
+    break;
+  case PIC_TYPE_RECORD: {
+    struct record *rec = rec_ptr(pic, obj);
+    dump_tag(pic, d, FASL_RECORD);
+    dump_obj(pic, d, obj_value(pic, rec->type));
+    for (i = 0; i < rec->type->nfields; ++i) {
+      dump_obj(pic, d, rec->slots[i]);
+    }
+    break;
+  }
+  case PIC_TYPE_PROC_IREP: {
+    struct proc *proc = proc_ptr(pic, obj);
+    dump_tag(pic, d, FASL_PROC);
+    dump_irep(pic, d, proc->u.irep);
+    if (proc->env) {
+      dump_obj(pic, d, obj_value(pic, proc->env));
+    } else {
+      dump_tag(pic, d, FASL_NIL);
+    }
+    break;
+  }
+  case PIC_TYPE_FRAME: {
+    struct frame *fp = (struct frame *) pic_ptr(pic, obj);
+    dump_tag(pic, d, FASL_FRAME);
+    dump_uint(pic, d, fp->regc);
+    if (fp->up) {
+      dump_obj(pic, d, obj_value(pic, fp->up));
+    } else {
+      dump_tag(pic, d, FASL_NIL);
+    }
+    for (i = 0; i < fp->regc; ++i) {
+      dump_obj(pic, d, fp->regs[i]);
+    }
+    break;
+  }
+  case PIC_TYPE_PROC_FUNC: {
+    khash_t(attr) *h;
+    int it;
+    if (! pic_attr_proc_p(pic, obj)) {
+      struct proc *proc = proc_ptr(pic, obj);
+      pic_value name = pic_func_name(pic, proc->u.func);
+      if (pic_false_p(pic, name)) {
+        pic_error(pic, "fasl: c function procedure serialization unsupported", 1, obj);
+      }
+      dump_tag(pic, d, FASL_FUNC);
+      dump_sym(pic, d, name);
+      if (proc->env) {
+        dump_obj(pic, d, obj_value(pic, proc->env));
+      } else {
+        dump_tag(pic, d, FASL_NIL);
+      }
+      break;
+    }
+    h = &attr_ptr(pic, proc_ptr(pic, obj)->env->regs[0])->hash;
+    dump_tag(pic, d, FASL_ATTR);
+    dump_uint(pic, d, kh_size(h));
+    for (it = kh_begin(h); it != kh_end(h); ++it) {
+      if (kh_exist(h, it)) {
+        dump_obj(pic, d, obj_value(pic, kh_key(h, it)));
+        dump_obj(pic, d, kh_val(h, it));
+      }
+    }
+    break;
+  }
+  default:
+    pic_error(pic, "fasl: unsupported object", 1, obj);
   }
 }
 
+static void
+dump_init(pic_state *pic, struct dumper *d)
+{
+  d->capa = 256;
+  d->blob = pic_blob_value(pic, NULL, d->capa);
+  d->buf = blob_ptr(pic, d->blob)->data;
+  d->len = 0;
+}
+
+static pic_value
+serialize(pic_state *pic, pic_value obj, pic_value extern_proc)
+{
+  static const unsigned char header[] = { 0x7f, 'f', 's', 'l', FASL_VERSION };
+  struct dumper d, out;
+  pic_value sym, idx, names;
+  int i, it = 0;
+  size_t ai = pic_enter(pic);
+
+  dump_init(pic, &d);
+  d.seen = pic_make_table(pic, PIC_TABLE_EQ);
+  d.syms = pic_make_dict(pic);
+  d.extern_proc = extern_proc;
+  d.externs = pic_make_table(pic, PIC_TABLE_EQ);
+  d.nlabels = d.nsyms = d.nrefs = 0;
+
+  scan_obj(pic, &d, obj);
+  dump_obj(pic, &d, obj);
+
+  /* the symbol table goes before the object, now that it is complete */
+  names = pic_make_vec(pic, d.nsyms, NULL);
+  while (pic_dict_next(pic, d.syms, &it, &sym, &idx)) {
+    vec_ptr(pic, names)->data[pic_int(pic, idx)] = sym;
+  }
+  dump_init(pic, &out);
+  dump_bytes(pic, &out, header, sizeof header);
+  dump_uint(pic, &out, d.nsyms);
+  for (i = 0; i < d.nsyms; ++i) {
+    const char *str;
+    int len;
+
+    str = pic_str(pic, pic_sym_name(pic, vec_ptr(pic, names)->data[i]), &len);
+    dump_uint(pic, &out, len);
+    dump_bytes(pic, &out, str, len);
+  }
+  dump_bytes(pic, &out, d.buf, d.len);
+
+  blob_ptr(pic, out.blob)->data = pic_realloc(pic, out.buf, out.len);
+  blob_ptr(pic, out.blob)->len = out.len;
+
+  pic_leave(pic, ai);
+  return pic_protect(pic, out.blob);
+}
+
 pic_value
 pic_serialize(pic_state *pic, pic_value obj)
 {
-  int len = 0;
-  pic_value blob;
-  dump_obj(pic, obj, NULL, &len);
-  blob = pic_blob_value(pic, NULL, len);
-  len = 0;
-  dump_obj(pic, obj, pic_blob(pic, blob, NULL), &len);
-  return blob;
+  return serialize(pic, obj, pic_false_value(pic));
+}
+
+struct loader {
+  const unsigned char *p, *end;
+  pic_value source;             /* blob holding the input, or #f if it is static */
+  pic_value labels, syms;       /* vectors, so that they need no cleanup on error */
+  pic_value resolve;            /* #f or key -> object */
+  int nlabels, nsyms;
+};
+
+static const unsigned char *
+load_bytes(pic_state *pic, struct loader *l, unsigned long n)
+{
+  const unsigned char *p = l->p;
+
+  if (n > (unsigned long) (l->end - l->p)) {
+    pic_error(pic, "fasl: truncated input", 0);
+  }
+  l->p += n;
+  return p;
+}
+
+static int
+load_tag(pic_state *pic, struct loader *l)
+{
+  return *load_bytes(pic, l, 1);
+}
+
+static unsigned long
+load_uint(pic_state *pic, struct loader *l)
+{
+  unsigned long n = 0;
+  int shift = 0, c;
+
+  do {
+    if (shift >= (int) (sizeof(long) * CHAR_BIT)) {
+      pic_error(pic, "fasl: malformed varint", 0);
+    }
+    c = load_tag(pic, l);
+    n |= (unsigned long) (c & 0x7f) << shift;
+    shift += 7;
+  } while (c & 0x80);
+  return n;
+}
+
+/* a count of things that each take at least one byte */
+static int
+load_count(pic_state *pic, struct loader *l)
+{
+  unsigned long n = load_uint(pic, l);
+
+  if (n > (unsigned long) (l->end - l->p)) {
+    pic_error(pic, "fasl: truncated input", 0);
+  }
+  return (int) n;
+}
+
+static double
+load_float(pic_state *pic, struct loader *l)
+{
+  static const int one = 1;
+  union { double f; unsigned char b[8]; } u;
+  const unsigned char *p = load_bytes(pic, l, 8);
+  int i;
+
+  for (i = 0; i < 8; ++i) {
+    u.b[*(const char *) &one ? i : 7 - i] = p[i];
+  }
+  return u.f;
+}
+
+static void
+load_push(pic_state *pic, pic_value *vec, int *n, pic_value obj)
+{
+  struct vector *v = vec_ptr(pic, *vec);
+
+  if (*n == v->len) {
+    *vec = pic_make_vec(pic, v->len * 2, NULL);
+    memcpy(vec_ptr(pic, *vec)->data, v->data, sizeof(pic_value) * v->len);
+  }
+  vec_ptr(pic, *vec)->data[(*n)++] = obj;
 }
 
-static void loadn(pic_state *pic, unsigned char *dst, size_t size, const unsigned char **buf, const unsigned char *end) {
-  if (*buf + size > end) {
-    pic_error(pic, "malformed bytevector", 0);
+static pic_value load_obj(pic_state *pic, struct loader *l);
+
+/* the live record type this state wrote under uid, or #f */
+static pic_value
+rectype_find(pic_state *pic, int uid, pic_value name, pic_value fields)
+{
+  khash_t(attr) *h = &attr_ptr(pic, proc_ptr(pic, pic->rectypes)->env->regs[0])->hash;
+  struct record_type *type;
+  int it;
+
+  for (it = kh_begin(h); it != kh_end(h); ++it) {
+    if (kh_exist(h, it) && pic_int(pic, kh_val(h, it)) == uid) {
+      type = (struct record_type *) kh_key(h, it);
+      if (pic_eq_p(pic, obj_value(pic, type->name), name) && pic_equal_p(pic, type->fields, fields)) {
+        return obj_value(pic, type);
+      }
+      break;
+    }
   }
-  memcpy(dst, *buf, size);
-  *buf = *buf + size;
+  return pic_false_value(pic);
 }
 
-static unsigned char load1(pic_state *pic, const unsigned char **buf, const unsigned char *end) {
-  unsigned char c;
-  loadn(pic, &c, 1, buf, end);
-  return c;
+static void
+load_define(pic_state *pic, struct loader *l, int label, pic_value obj)
+{
+  if (label >= 0) {
+    vec_ptr(pic, l->labels)->data[label] = obj;
+  }
 }
 
-static unsigned long load4(pic_state *pic, const unsigned char **buf, const unsigned char *end) {
-  unsigned long x = load1(pic, buf, end);
-  x += load1(pic, buf, end) << 8;
-  x += load1(pic, buf, end) << 16;
-  x += load1(pic, buf, end) << 24;
-  return x;
+static pic_value
+load_sym(pic_state *pic, struct loader *l)
+{
+  unsigned long n;
+
+  if (load_tag(pic, l) != FASL_SYMBOL) {
+    pic_error(pic, "fasl: symbol expected", 0);
+  }
+  n = load_uint(pic, l);
+  if (n >= (unsigned long) l->nsyms) {
+    pic_error(pic, "fasl: bad reference", 0);
+  }
+  return vec_ptr(pic, l->syms)->data[n];
 }
 
-static pic_value load_obj(pic_state *pic, const unsigned char **buf, const unsigned char *end);
+/* the nested irep in the next len bytes, left to pic_force_irep */
+static struct irep *
+load_lazy_irep(pic_state *pic, struct loader *l)
+{
+  struct irep *irep;
+  int len = load_count(pic, l);
+
+  irep = (struct irep *) pic_obj_alloc(pic, PIC_TYPE_IREP);
+  irep->argc = irep->frame_size = 0;
+  irep->flags = IREP_LAZY | IREP_CODE_STATIC;
+  irep->objc = irep->irepc = 0;
+  irep->irep = NULL;
+  irep->obj = pic_malloc(pic, sizeof(pic_value) * 2);
+  irep->obj[0] = l->source;
+  irep->obj[1] = l->syms;
+  irep->objc = 2;
+  irep->code = load_bytes(pic, l, len);
+  irep->codec = len;
+  return irep;
+}
 
 static struct irep *
-load_irep(pic_state *pic, const unsigned char **buf, const unsigned char *end)
+load_irep(pic_state *pic, struct loader *l, int label)
 {
-  unsigned char argc, flags, frame_size, irepc, objc;
-  size_t codec, i;
-  pic_value *obj;
-  unsigned char *code;
-  struct irep **irep, *ir;
-  size_t ai = pic_enter(pic);
+  struct irep *irep;
+  int argc, flags, frame_size, objc, irepc, i;
+  unsigned long codec;
+  pic_value obj;
+
+  switch (load_tag(pic, l)) {
+  case FASL_IREP:
+    break;
+  case FASL_DEF:
+  case FASL_REF:
+    l->p--;
+    obj = load_obj(pic, l);
+    if (pic_type(pic, obj) != PIC_TYPE_IREP) {
+      pic_error(pic, "fasl: code expected", 0);
+    }
+    return irep_ptr(pic, obj);
+  default:
+    pic_error(pic, "fasl: code expected", 0);
+  }
+
+  argc = load_uint(pic, l);
+  flags = load_uint(pic, l) & IREP_FLAGS_MASK;
+  frame_size = load_uint(pic, l);
+  objc = load_count(pic, l);
+  irepc = load_count(pic, l);
+  codec = load_count(pic, l);
+  if (argc > UCHAR_MAX || frame_size > UCHAR_MAX || objc > UCHAR_MAX || irepc > UCHAR_MAX) {
+    pic_error(pic, "fasl: malformed code", 0);
+  }
+
+  /* objc and irepc count what has been loaded so far, for the GC's sake */
+  irep = (struct irep *) pic_obj_alloc(pic, PIC_TYPE_IREP);
+  irep->argc = argc;
+  irep->flags = flags;
+  irep->frame_size = frame_size;
+  irep->objc = irep->irepc = 0;
+  irep->codec = 0;
+  irep->obj = pic_malloc(pic, sizeof(pic_value) * objc);
+  irep->irep = pic_malloc(pic, sizeof(struct irep *) * irepc);
+  irep->code = NULL;
+  load_define(pic, l, label, obj_value(pic, irep));
 
-  argc = load1(pic, buf, end);
-  flags = load1(pic, buf, end);
-  frame_size = load1(pic, buf, end);
-  irepc = load1(pic, buf, end);
-  objc = load1(pic, buf, end);
-  codec = load4(pic, buf, end);
-  obj = pic_malloc(pic, sizeof(pic_value) * objc);
   for (i = 0; i < objc; ++i) {
-    obj[i] = load_obj(pic, buf, end);
+    obj = load_obj(pic, l);
+    irep->obj[irep->objc++] = obj;
   }
-  code = pic_malloc(pic, codec); /* TODO */
-  loadn(pic, code, codec, buf, end);
-  irep = pic_malloc(pic, sizeof(struct irep *) * irepc);
+  if (pic_false_p(pic, l->source)) {
+    irep->code = load_bytes(pic, l, codec);
+    irep->flags |= IREP_CODE_STATIC;
+  } else {
+    irep->code = pic_malloc(pic, codec);
+    memcpy((code_t *) irep->code, load_bytes(pic, l, codec), codec);
+  }
+  irep->codec = codec;
   for (i = 0; i < irepc; ++i) {
-    irep[i] = load_irep(pic, buf, end);
-  }
-  ir = (struct irep *) pic_obj_alloc(pic, PIC_TYPE_IREP);
-  ir->argc = argc;
-  ir->flags = flags;
-  ir->frame_size = frame_size;
-  ir->irepc = irepc;
-  ir->objc = objc;
-  ir->codec = codec;
-  ir->obj = obj;
-  ir->code = code;
-  ir->irep = irep;
-  pic_leave(pic, ai);
-  pic_protect(pic, obj_value(pic, ir));
-  return ir;
+    struct irep *child;
+    if (l->p < l->end && *l->p == FASL_LAZY) {
+      l->p++;
+      child = load_lazy_irep(pic, l);
+    } else {
+      child = load_irep(pic, l, -1);
+    }
+    irep->irep[irep->irepc++] = child;
+  }
+  return irep;
 }
 
 static pic_value
-load_obj(pic_state *pic, const unsigned char **buf, const unsigned char *end)
+load_tagged(pic_state *pic, struct loader *l, int tag, int label)
 {
-  int type, l;
   pic_value obj;
-  char *dat, c;
-  struct irep *irep;
-  struct proc *proc;
-  type = load1(pic, buf, end);
-  switch (type) {
-  case 0x00:
-    return pic_int_value(pic, load4(pic, buf, end));
-  case 0x01:
-    l = load4(pic, buf, end);
-    dat = pic_malloc(pic, l + 1); /* TODO */
-    loadn(pic, (unsigned char *) dat, l + 1, buf, end);
-    obj = pic_str_value(pic, dat, l);
-    pic_free(pic, dat);
+  unsigned long u;
+  int n, i;
+
+  switch (tag) {
+  case FASL_NIL:
+    obj = pic_nil_value(pic);
+    break;
+  case FASL_TRUE:
+    obj = pic_true_value(pic);
+    break;
+  case FASL_FALSE:
+    obj = pic_false_value(pic);
+    break;
+  case FASL_UNDEF:
+    obj = pic_undef_value(pic);
+    break;
+  case FASL_EOF:
+    obj = pic_eof_object(pic);
+    break;
+  case FASL_INVALID:
+    obj = pic_invalid_value(pic);
+    break;
+  case FASL_INT: {
+    long v;
+    u = load_uint(pic, l);
+    v = (long) (u >> 1) ^ -(long) (u & 1);
+    if (v < INT_MIN || INT_MAX < v) {
+      pic_error(pic, "fasl: integer out of range", 0);
+    }
+    obj = pic_int_value(pic, v);
+    break;
+  }
+  case FASL_FLOAT:
+    obj = pic_float_value(pic, load_float(pic, l));
+    break;
+  case FASL_CHAR:
+    obj = pic_char_value(pic, (char) load_tag(pic, l));
+    break;
+  case FASL_STRING:
+    u = load_uint(pic, l);
+    obj = pic_str_value(pic, (const char *) load_bytes(pic, l, u), u);
+    break;
+  case FASL_BLOB:
+    u = load_uint(pic, l);
+    obj = pic_blob_value(pic, load_bytes(pic, l, u), u);
+    break;
+  case FASL_SYMBOL:
+    l->p--;
+    obj = load_sym(pic, l);
+    break;
+  case FASL_LIST: {
+    pic_value pair, next;
+    n = load_count(pic, l);
+    if (n == 0) {
+      pic_error(pic, "fasl: malformed list", 0);
+    }
+    obj = pair = pic_cons(pic, pic_undef_value(pic), pic_undef_value(pic));
+    load_define(pic, l, label, obj);
+    for (i = 0; ; ++i) {
+      pic_set_car(pic, pair, load_obj(pic, l));
+      if (i == n - 1) {
+        break;
+      }
+      next = pic_cons(pic, pic_undef_value(pic), pic_undef_value(pic));
+      pic_set_cdr(pic, pair, next);
+      pair = next;
+    }
+    pic_set_cdr(pic, pair, load_obj(pic, l));
     return obj;
-  case 0x02:
-    l = load4(pic, buf, end);
-    dat = pic_malloc(pic, l + 1); /* TODO */
-    loadn(pic, (unsigned char *) dat, l + 1, buf, end);
-    obj = pic_intern_str(pic, dat, l);
-    pic_free(pic, dat);
+  }
+  case FASL_VECTOR:
+    n = load_count(pic, l);
+    obj = pic_make_vec(pic, n, NULL);
+    load_define(pic, l, label, obj);
+    for (i = 0; i < n; ++i) {
+      pic_value elem = load_obj(pic, l);
+      vec_ptr(pic, obj)->data[i] = elem;
+    }
+    return obj;
+  case FASL_DICT:
+    n = load_count(pic, l);
+    obj = pic_make_dict(pic);
+    load_define(pic, l, label, obj);
+    for (i = 0; i < n; ++i) {
+      pic_value key = load_sym(pic, l);
+      pic_dict_set(pic, obj, key, load_obj(pic, l));
+    }
+    return obj;
+  case FASL_TABLE: {
+    int kind = load_uint(pic, l);
+    if (kind > PIC_TABLE_STRING) {
+      pic_error(pic, "fasl: malformed hash table", 0);
+    }
+    n = load_count(pic, l);
+    obj = pic_make_table(pic, kind);
+    load_define(pic, l, label, obj);
+    for (i = 0; i < n; ++i) {
+      pic_value key = load_obj(pic, l);
+      pic_table_set(pic, obj, key, load_obj(pic, l));
+    }
     return obj;
-  case 0x03:
-    irep = load_irep(pic, buf, end);
-    proc = (struct proc *)pic_obj_alloc(pic, PIC_TYPE_PROC_IREP);
-    proc->u.irep = irep;
-    proc->env = NULL;
-    return obj_value(pic, proc);
-  case 0x04:
-    c = load1(pic, buf, end);
-    return pic_char_value(pic, c);
+  }
+  case FASL_RECTYPE: {
+    int uid = (int) load_uint(pic, l);
+    pic_value name = load_sym(pic, l), fields = load_obj(pic, l);
+    obj = rectype_find(pic, uid, name, fields);
+    if (pic_false_p(pic, obj)) {
+      obj = pic_make_record_type(pic, name, fields);
+    }
+    break;
+  }
+  case FASL_RECORD: {
+    pic_value type = load_obj(pic, l);
+    struct record *rec;
+    if (! pic_rectype_p(pic, type)) {
+      pic_error(pic, "fasl: record type expected", 0);
+    }
+    obj = pic_make_record(pic, type, rectype_ptr(pic, type)->nfields, NULL);
+    load_define(pic, l, label, obj);
+    rec = rec_ptr(pic, obj);
+    for (i = 0; i < rec->type->nfields; ++i) {
+      pic_value slot = load_obj(pic, l);
+      rec->slots[i] = slot;
+    }
+    return obj;
+  }
+  case FASL_IREP:
+    l->p--;
+    return obj_value(pic, load_irep(pic, l, label));
+  case FASL_FRAME: {
+    struct frame *fp;
+    pic_value up;
+    n = load_uint(pic, l);
+    if (n > UCHAR_MAX) {
+      pic_error(pic, "fasl: malformed frame", 0);
+    }
+    fp = pic_make_frame_unsafe(pic, n);
+    obj = obj_value(pic, fp);
+    pic_protect(pic, obj);
+    load_define(pic, l, label, obj);
+    up = load_obj(pic, l);
+    if (! pic_nil_p(pic, up)) {
+      if (pic_type(pic, up) != PIC_TYPE_FRAME) {
+        pic_error(pic, "fasl: frame expected", 0);
+      }
+      fp->up = (struct frame *) pic_ptr(pic, up);
+    }
+    for (i = 0; i < n; ++i) {
+      pic_value reg = load_obj(pic, l);
+      fp->regs[i] = reg;
+    }
+    return obj;
+  }
+  case FASL_PROC: {
+    struct irep *irep = load_irep(pic, l, -1);
+    pic_value env;
+    obj = pic_make_proc_irep_unsafe(pic, irep, NULL);
+    pic_protect(pic, obj);
+    load_define(pic, l, label, obj);
+    env = load_obj(pic, l);
+    if (! pic_nil_p(pic, env)) {
+      if (pic_type(pic, env) != PIC_TYPE_FRAME) {
+        pic_error(pic, "fasl: frame expected", 0);
+      }
+      proc_ptr(pic, obj)->env = (struct frame *) pic_ptr(pic, env);
+    }
+    return obj;
+  }
+  case FASL_FUNC: {
+    pic_value name = load_sym(pic, l), env;
+    pic_func_t f = pic_func_ref(pic, name);
+    if (f == NULL) {
+      pic_error(pic, "fasl: unknown c function", 1, name);
+    }
+    obj = pic_lambda(pic, f, 0);
+    load_define(pic, l, label, obj);
+    env = load_obj(pic, l);
+    if (! pic_nil_p(pic, env)) {
+      if (pic_type(pic, env) != PIC_TYPE_FRAME) {
+        pic_error(pic, "fasl: frame expected", 0);
+      }
+      proc_ptr(pic, obj)->env = (struct frame *) pic_ptr(pic, env);
+    }
+    return obj;
+  }
+  case FASL_ATTR:
+    n = load_count(pic, l);
+    obj = pic_make_attr(pic);
+    load_define(pic, l, label, obj);
+    for (i = 0; i < n; ++i) {
+      pic_value key = load_obj(pic, l);
+      if (! pic_obj_p(pic, key)) {
+        pic_error(pic, "fasl: malformed attribute", 0);
+      }
+      pic_attr_set(pic, obj, key, load_obj(pic, l));
+    }
+    return obj;
+  case FASL_EXTERN:
+    if (pic_false_p(pic, l->resolve)) {
+      pic_error(pic, "fasl: external object without a resolver", 0);
+    }
+    obj = pic_call(pic, l->resolve, 1, load_obj(pic, l));
+    break;
   default:
-    pic_error(pic, "load: unsupported object", 1, pic_int_value(pic, type));
+    pic_error(pic, "fasl: unknown tag", 0);
   }
+  load_define(pic, l, label, obj);
+  return obj;
+}
+
+static pic_value
+load_obj(pic_state *pic, struct loader *l)
+{
+  unsigned long n;
+  int tag;
+
+  switch (tag = load_tag(pic, l)) {
+  case FASL_DEF:
+    if (load_uint(pic, l) != (unsigned long) l->nlabels) {
+      pic_error(pic, "fasl: bad label", 0);
+    }
+    n = l->nlabels;
+    load_push(pic, &l->labels, &l->nlabels, pic_invalid_value(pic));
+    tag = load_tag(pic, l);
+    if (tag == FASL_DEF || tag == FASL_REF) {
+      pic_error(pic, "fasl: bad label", 0);
+    }
+    return load_tagged(pic, l, tag, n);
+  case FASL_REF:
+    n = load_uint(pic, l);
+    if (n >= (unsigned long) l->nlabels || pic_invalid_p(pic, vec_ptr(pic, l->labels)->data[n])) {
+      pic_error(pic, "fasl: bad reference", 0);
+    }
+    return vec_ptr(pic, l->labels)->data[n];
+  default:
+    return load_tagged(pic, l, tag, -1);
+  }
+}
+
+/* source is #f if buf is static, or else a blob of its own */
+static pic_value
+deserialize(pic_state *pic, const unsigned char *buf, int len, pic_value source, pic_value resolve)
+{
+  struct loader l;
+  pic_value obj;
+  unsigned long n;
+  int i;
+  size_t ai = pic_enter(pic);
+
+  l.p = buf;
+  l.end = l.p + len;
+  if (len < 5 || memcmp(l.p, "\x7f" "fsl", 4) != 0) {
+    pic_error(pic, "fasl: not a serialized object", 0);
+  }
+  if (l.p[4] != FASL_VERSION) {
+    pic_error(pic, "fasl: unsupported version", 1, pic_int_value(pic, l.p[4]));
+  }
+  l.p += 5;
+  l.source = source;
+  l.labels = pic_make_vec(pic, 16, NULL);
+  l.nsyms = load_count(pic, &l);
+  l.syms = pic_make_vec(pic, l.nsyms, NULL);
+  for (i = 0; i < l.nsyms; ++i) {
+    n = load_uint(pic, &l);
+    vec_ptr(pic, l.syms)->data[i] = pic_intern_str(pic, (const char *) load_bytes(pic, &l, n), n);
+  }
+  l.resolve = resolve;
+  l.nlabels = 0;
+
+  obj = load_obj(pic, &l);
+  if (l.p != l.end) {
+    pic_error(pic, "fasl: trailing garbage", 0);
+  }
+
+  pic_leave(pic, ai);
+  return pic_protect(pic, obj);
+}
+
+/* the input is copied, for the ireps left undecoded refer into it */
+static pic_value
+deserialize_blob(pic_state *pic, pic_value blob, pic_value resolve)
+{
+  const unsigned char *buf;
+  int len;
+
+  buf = pic_blob(pic, blob, &len);
+  blob = pic_blob_value(pic, buf, len);
+  return deserialize(pic, pic_blob(pic, blob, NULL), len, blob, resolve);
 }
 
 pic_value
 pic_deserialize(pic_state *pic, pic_value blob)
 {
-  int len;
-  const unsigned char *buf = pic_blob(pic, blob, &len);
-  return load_obj(pic, &buf, buf + len);
+  return deserialize_blob(pic, blob, pic_false_value(pic));
+}
+
+/*
+ * Nothing is copied out of buf or written to it, so one image can be
+ * loaded by any number of states and they all run the same code bytes.
+ * What each state still makes of its own is the irep headers and the
+ * literals of the code it actually runs.
+ */
+pic_value
+pic_deserialize_static(pic_state *pic, const unsigned char *buf, int len, pic_value resolve)
+{
+  if (! pic_false_p(pic, resolve)) {
+    TYPE_CHECK(pic, resolve, proc);
+  }
+  return deserialize(pic, buf, len, pic_false_value(pic), resolve);
+}
+
+void
+pic_force_irep(pic_state *pic, struct irep *irep)
+{
+  struct loader l;
+  struct irep *tmp;
+  size_t ai = pic_enter(pic);
+
+  assert(irep->flags & IREP_LAZY);
+
+  l.p = irep->code;
+  l.end = l.p + irep->codec;
+  l.source = irep->obj[0];
+  l.labels = pic_make_vec(pic, 16, NULL);
+  l.syms = irep->obj[1];
+  l.resolve = pic_false_value(pic);
+  l.nlabels = 0;
+  l.nsyms = vec_ptr(pic, l.syms)->len;
+
+  tmp = load_irep(pic, &l, -1);
+  if (l.p != l.end) {
+    pic_error(pic, "fasl: trailing garbage", 0);
+  }
+
+  /* move the decoded irep into place and leave tmp empty for the GC */
+  pic_free(pic, irep->obj);
+  irep->argc = tmp->argc;
+  irep->flags = tmp->flags;
+  irep->frame_size = tmp->frame_size;
+  irep->objc = tmp->objc;
+  irep->irepc = tmp->irepc;
+  irep->obj = tmp->obj;
+  irep->irep = tmp->irep;
+  irep->code = tmp->code;
+  irep->codec = tmp->codec;
+  tmp->flags = IREP_CODE_STATIC;
+  tmp->objc = tmp->irepc = 0;
+  tmp->obj = NULL;
+  tmp->irep = NULL;
+  tmp->code = NULL;
+  tmp->codec = 0;
+
+  pic_leave(pic, ai);
+}
+
+/*
+ * heap image
+ *
+ * The global variables and the dynamic environment, which between them
+ * reach every object a program can get at, serialized as one list. The
+ * top continuation and the standard ports are written as their numbers.
+ * Loading an image replaces the globals and the dynamic environment of a
+ * state whose C libraries have been initialized the same way as those of
+ * the state that saved it, so that the C functions it names are
+ * registered. Neither saving nor loading may be done inside pic_try: the
+ * exception handler it binds cannot be saved, and a load would discard
+ * it. Reading an image, where a bad one is caught, may be.
+ */
+
+static pic_value
+image_fixed(pic_state *pic)
+{
+#if PIC_USE_PORT
+  return pic_list(pic, 4, pic->halt, pic_stdin(pic), pic_stdout(pic), pic_stderr(pic));
+#else
+  return pic_list(pic, 1, pic->halt);
+#endif
+}
+
+static pic_value
+image_extern(pic_state *pic)
+{
+  pic_value obj, fixed = pic_closure_ref(pic, 0);
+  int i;
+
+  pic_get_args(pic, "o", &obj);
+
+  for (i = 0; ! pic_nil_p(pic, fixed); ++i, fixed = pic_cdr(pic, fixed)) {
+    if (pic_eq_p(pic, obj, pic_car(pic, fixed))) {
+      return pic_int_value(pic, i);
+    }
+  }
+  return pic_false_value(pic);
+}
+
+static pic_value
+image_resolve(pic_state *pic)
+{
+  pic_value key, fixed = pic_closure_ref(pic, 0);
+
+  pic_get_args(pic, "o", &key);
+
+  if (! pic_int_p(pic, key) || pic_int(pic, key) < 0 || pic_int(pic, key) >= pic_length(pic, fixed)) {
+    pic_error(pic, "image: unknown external object", 1, key);
+  }
+  return pic_list_ref(pic, fixed, pic_int(pic, key));
+}
+
+pic_value
+pic_save_image(pic_state *pic)
+{
+  size_t ai = pic_enter(pic);
+  pic_value roots, extern_proc, image;
+
+  roots = pic_list(pic, 2, pic->globals, pic->dyn_env);
+  extern_proc = pic_lambda(pic, image_extern, 1, image_fixed(pic));
+  image = serialize(pic, roots, extern_proc);
+  pic_leave(pic, ai);
+  return pic_protect(pic, image);
+}
+
+pic_value
+pic_read_image(pic_state *pic, pic_value image)
+{
+  size_t ai = pic_enter(pic);
+  pic_value roots, resolve;
+
+  resolve = pic_lambda(pic, image_resolve, 1, image_fixed(pic));
+  roots = deserialize_blob(pic, image, resolve);
+  if (! pic_list_p(pic, roots) || pic_length(pic, roots) != 2 || ! pic_dict_p(pic, pic_car(pic, roots))) {
+    pic_error(pic, "image: malformed image", 0);
+  }
+  pic_leave(pic, ai);
+  return pic_protect(pic, roots);
+}
+
+void
+pic_load_image(pic_state *pic, pic_value roots)
+{
+  pic->globals = pic_car(pic, roots);
+  pic->dyn_env = pic_cadr(pic, roots);
 }
 
 pic_value
@@ -237,6 +1347,33 @@ pic_blob(pic_state *pic, pic_value blob, int *len)
   return bv->data;
 }
 
+/* the caller gets the bytes and frees them with pic_free; blob is left empty */
+unsigned char *
+pic_blob_take(pic_state *pic, pic_value blob, int *len)
+{
+  struct blob *bv = blob_ptr(pic, blob);
+  unsigned char *data = bv->data;
+
+  if (len) {
+    *len = bv->len;
+  }
+  bv->data = NULL;
+  bv->len = 0;
+  return data;
+}
+
+/* buf must come from pic_malloc, and now belongs to the bytevector */
+pic_value
+pic_blob_adopt(pic_state *pic, unsigned char *buf, int len)
+{
+  struct blob *bv;
+
+  bv = (struct blob *)pic_obj_alloc(pic, PIC_TYPE_BLOB);
+  bv->data = buf;
+  bv->len = len;
+  return obj_value(pic, bv);
+}
+
 static pic_value
 pic_blob_bytevector_p(pic_state *pic)
 {
@@ -459,23 +1596,28 @@ pic_blob_bytevector_to_list(pic_state *pic)
 static pic_value
 pic_blob_object_to_bytevector(pic_state *pic)
 {
-  pic_value obj;
+  pic_value obj, extern_proc = pic_false_value(pic);
 
-  pic_get_args(pic, "o", &obj);
+  pic_get_args(pic, "o|o", &obj, &extern_proc);
 
-  return pic_serialize(pic, obj);
+  if (! pic_false_p(pic, extern_proc)) {
+    TYPE_CHECK(pic, extern_proc, proc);
+  }
+  return serialize(pic, obj, extern_proc);
 }
 
 static pic_value
 pic_blob_bytevector_to_object(pic_state *pic)
 {
-  pic_value blob;
+  pic_value blob, resolve = pic_false_value(pic);
 
-  pic_get_args(pic, "o", &blob);
+  pic_get_args(pic, "o|o", &blob, &resolve);
 
   TYPE_CHECK(pic, blob, blob);
-
-  return pic_deserialize(pic, blob);
+  if (! pic_false_p(pic, resolve)) {
+    TYPE_CHECK(pic, resolve, proc);
+  }
+  return deserialize_blob(pic, blob, resolve);
 }
 
 void
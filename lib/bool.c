@@ -19,8 +19,33 @@ pic_eqv_p(pic_state *PIC_UNUSED(pic), pic_value x, pic_value y)
   return value_eq_p(&x, &y);
 }
 
-bool
-pic_equal_p(pic_state *pic, pic_value x, pic_value y)
+/*
+ * Past EQUAL_BUDGET containers, equal? takes the objects for a graph that
+ * may have cycles: it writes down every pair of containers it starts to
+ * compare and takes a pair met again for equal, which it is if the rest
+ * of the comparison succeeds.
+ */
+
+#define EQUAL_BUDGET 1000
+
+static bool
+seen_p(pic_state *pic, pic_value seen, pic_value x, pic_value y)
+{
+  pic_value ys = pic_nil_value(pic), it, z;
+
+  if (pic_attr_has(pic, seen, x)) {
+    ys = pic_attr_ref(pic, seen, x);
+    pic_for_each (z, ys, it) {
+      if (pic_eq_p(pic, y, z))
+        return true;
+    }
+  }
+  pic_attr_set(pic, seen, x, pic_cons(pic, y, ys));
+  return false;
+}
+
+static bool
+internal_equal_p(pic_state *pic, pic_value x, pic_value y, int *budget, pic_value *seen)
 {
  LOOP:
 
@@ -31,6 +56,26 @@ pic_equal_p(pic_state *pic, pic_value x, pic_value y)
     return false;
   }
 
+  switch (pic_type(pic, x)) {
+  case PIC_TYPE_PAIR:
+  case PIC_TYPE_VECTOR:
+  case PIC_TYPE_DICT:
+  case PIC_TYPE_RECORD:
+    if (*budget > 0) {
+      --*budget;
+    } else {
+      if (pic_false_p(pic, *seen)) {
+        *seen = pic_make_attr(pic);
+      }
+      if (seen_p(pic, *seen, x, y)) {
+        return true;
+      }
+    }
+    break;
+  default:
+    break;
+  }
+
   switch (pic_type(pic, x)) {
   case PIC_TYPE_STRING: {
     int xlen, ylen;
@@ -57,7 +102,7 @@ pic_equal_p(pic_state *pic, pic_value x, pic_value y)
     return memcmp(xbuf, ybuf, xlen) == 0;
   }
   case PIC_TYPE_PAIR: {
-    if (! pic_equal_p(pic, pic_car(pic, x), pic_car(pic, y))) {
+    if (! internal_equal_p(pic, pic_car(pic, x), pic_car(pic, y), budget, seen)) {
       return false;
     }
     x = pic_cdr(pic, x);
@@ -74,7 +119,7 @@ pic_equal_p(pic_state *pic, pic_value x, pic_value y)
       return false;
     }
     for (i = 0; i < xlen; ++i) {
-      if (! pic_equal_p(pic, pic_vec_ref(pic, x, i), pic_vec_ref(pic, y, i)))
+      if (! internal_equal_p(pic, pic_vec_ref(pic, x, i), pic_vec_ref(pic, y, i), budget, seen))
         return false;
     }
     return true;
@@ -89,18 +134,23 @@ pic_equal_p(pic_state *pic, pic_value x, pic_value y)
     while (pic_dict_next(pic, x, &it, &key, &val)) {
       if (! pic_dict_has(pic, y, key))
         return false;
-      if (! pic_equal_p(pic, val, pic_dict_ref(pic, y, key)))
+      if (! internal_equal_p(pic, val, pic_dict_ref(pic, y, key), budget, seen))
         return false;
     }
     return true;
   }
   case PIC_TYPE_RECORD: {
+    int i, len;
+
     if (! pic_eq_p(pic, pic_record_type(pic, x), pic_record_type(pic, y))) {
       return false;
     }
-    x = pic_record_datum(pic, x);
-    y = pic_record_datum(pic, y);
-    goto LOOP;
+    len = pic_record_len(pic, x);
+    for (i = 0; i < len; ++i) {
+      if (! internal_equal_p(pic, pic_record_ref(pic, x, i), pic_record_ref(pic, y, i), budget, seen))
+        return false;
+    }
+    return true;
   }
   case PIC_TYPE_DATA: {
     return pic_data(pic, x) == pic_data(pic, y);
@@ -110,6 +160,19 @@ pic_equal_p(pic_state *pic, pic_value x, pic_value y)
   }
 }
 
+bool
+pic_equal_p(pic_state *pic, pic_value x, pic_value y)
+{
+  size_t ai = pic_enter(pic);
+  int budget = EQUAL_BUDGET;
+  pic_value seen = pic_false_value(pic);
+  bool r;
+
+  r = internal_equal_p(pic, x, y, &budget, &seen);
+  pic_leave(pic, ai);
+  return r;
+}
+
 static pic_value
 pic_bool_eq_p(pic_state *pic)
 {
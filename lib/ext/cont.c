@@ -17,7 +17,7 @@
 static pic_value
 pic_cont_reset(pic_state *pic)
 {
-  pic_value thunk, prev = pic_ref(pic, "__picrin_dynenv__");
+  pic_value thunk, prev = pic->dyn_env;
   struct context cxt;
 
   pic_get_args(pic, "l", &thunk);
@@ -25,23 +25,23 @@ pic_cont_reset(pic_state *pic)
   CONTEXT_INITK(pic, &cxt, thunk, pic->halt, 0, (pic_value *) NULL);
   cxt.reset = 1;
   pic_vm(pic, &cxt);
-  pic_set(pic, "__picrin_dynenv__", prev);
+  pic_dynenv_reroot(pic, prev);
   return pic_protect(pic, cxt.fp->regs[1]);
 }
 
 static pic_value
 shift_call(pic_state *pic)
 {
-  pic_value x, prev = pic_ref(pic, "__picrin_dynenv__");
+  pic_value x, prev = pic->dyn_env;
   struct context cxt;
 
   pic_get_args(pic, "o", &x);
 
   CONTEXT_INIT(pic, &cxt, pic_closure_ref(pic, 0), 1, &x);
   cxt.reset = 1;
-  pic_set(pic, "__picrin_dynenv__", pic_closure_ref(pic, 1));
+  pic_dynenv_reroot(pic, pic_closure_ref(pic, 1));
   pic_vm(pic, &cxt);
-  pic_set(pic, "__picrin_dynenv__", prev);
+  pic_dynenv_reroot(pic, prev);
   return pic_protect(pic, cxt.fp->regs[1]);
 }
 
@@ -56,38 +56,83 @@ pic_cont_shift(pic_state *pic)
     pic_error(pic, "c function call interleaved in delimited continuation", 0);
   }
 
-  k = pic_lambda(pic, shift_call, 2, pic->cxt->fp->regs[1], pic_ref(pic, "__picrin_dynenv__"));
+  k = pic_lambda(pic, shift_call, 2, pic->cxt->fp->regs[1], pic->dyn_env);
+  CAPTURED(pic);
   CONTEXT_INITK(pic, pic->cxt, f, pic->halt, 1, &k);
+  pic->cxt->foreign = false;
   return pic_invalid_value(pic);
 }
 
+/*
+ * A continuation is the frames it returns to, which live on the heap, so
+ * calling one is a tail call to them: in the context it was captured in,
+ * or, once that has exited, in the caller's. Only when it was captured in
+ * a context that is still running further out does it have to unwind the
+ * C stack, by a longjmp.
+ *
+ * Frames captured in an exited context end in the halt of a C call that
+ * has already returned. The context they run in is marked foreign until
+ * a continuation of its own takes over again, and if control reaches
+ * the halt before that, it is an error.
+ */
+
+struct cont {
+  struct context *cxt;
+  unsigned long id;
+  bool foreign;
+};
+
+static void
+cont_dtor(pic_state *pic, void *data)
+{
+  pic_free(pic, data);
+}
+
+static const pic_data_type cont_type = { "cont", cont_dtor, NULL };
+
 static pic_value
 cont_call(pic_state *pic)
 {
   int argc;
   pic_value *argv, k, dyn_env;
   struct context *cxt;
+  struct cont *c;
 
   pic_get_args(pic, "*", &argc, &argv);
 
-  if (! pic_bool(pic, pic_closure_ref(pic, 0))) {
-    pic_error(pic, "calling dead escape continuation", 0);
+  c = pic_data(pic, pic_closure_ref(pic, 0));
+  k = pic_closure_ref(pic, 1);
+  dyn_env = pic_closure_ref(pic, 2);
+
+  for (cxt = pic->cxt; cxt != NULL; cxt = cxt->prev) {
+    if (cxt == c->cxt && cxt->id == c->id)
+      break;
   }
 
-  cxt = pic_data(pic, pic_closure_ref(pic, 1));
-  k = pic_closure_ref(pic, 2);
-  dyn_env = pic_closure_ref(pic, 3);
+  if (cxt == pic->cxt || cxt == NULL) {
+    if (cxt == NULL && ! pic_proc_p(pic, k)) {
+      /* the one pic_try makes has no frames to go on with */
+      pic_error(pic, "calling dead escape continuation", 0);
+    }
+    pic->cxt->foreign = cxt == NULL || c->foreign;
+    pic_dynenv_reroot(pic, dyn_env);
+    CONTEXT_INIT(pic, pic->cxt, k, argc, argv);
+    return pic_invalid_value(pic);
+  }
 
   CONTEXT_INIT(pic, cxt, k, argc, argv);
+  cxt->foreign = c->foreign;
 
   while (pic->cxt != cxt) {
-    pic_value c, it;
-    pic_for_each (c, pic->cxt->conts, it) {
-      proc_ptr(pic, c)->env->regs[0] = pic_false_value(pic);
+    if (pic->cxt == pic->budget) {
+      /* escaping a task started by pic_run ends it */
+      pic->cxt->sp = NULL;
+      pic->fuel = -1;
+      pic->budget = NULL;
     }
     pic->cxt = pic->cxt->prev;
   }
-  pic_set(pic, "__picrin_dynenv__", dyn_env);
+  pic_dynenv_reroot(pic, dyn_env);
 
   longjmp(cxt->jmp, 1);
   PIC_UNREACHABLE();
@@ -96,11 +141,14 @@ cont_call(pic_state *pic)
 pic_value
 pic_make_cont(pic_state *pic, pic_value k)
 {
-  static const pic_data_type cxt_type = { "cxt", NULL };
-  pic_value c;
-  c = pic_lambda(pic, cont_call, 4, pic_true_value(pic), pic_data_value(pic, pic->cxt, &cxt_type), k, pic_ref(pic, "__picrin_dynenv__"));
-  pic->cxt->conts = pic_cons(pic, c, pic->cxt->conts);
-  return c;
+  struct cont *c;
+
+  c = pic_malloc(pic, sizeof(struct cont));
+  c->cxt = pic->cxt;
+  c->id = pic->cxt->id;
+  c->foreign = pic->cxt->foreign;
+  CAPTURED(pic);
+  return pic_lambda(pic, cont_call, 3, pic_data_value(pic, c, &cont_type), k, pic->dyn_env);
 }
 
 static pic_value
@@ -38,6 +38,10 @@
 **    of the quotient LSB and remainder; this avoids doing the divide twice. 
 */
 
+#include <picrin.h>
+
+#if PIC_USE_LIBC
+
 #include <stdlib.h>
 #include <limits.h>
 #include <stdint.h>
@@ -141,7 +145,7 @@ static inline int nlz64 (uint64_t x)
 ** m >= 0 (unstated).  Therefore m+n >= n.) 
 */
 
-int quornd (uint32_t q[], const uint32_t u[], const uint32_t v[], int m, int n)
+static int quornd (uint32_t q[], const uint32_t u[], const uint32_t v[], int m, int n)
 {
     const uint64_t b = 4294967296ULL; // Number base (2**32).
     uint32_t un[BIGNUM_JUMBO_SIZE_UINT32]; // Normalized form of u, v.
@@ -431,7 +435,7 @@ static inline void mulbyu64 (uint32_t p[], const uint64_t u64mant, const uint32_
 ** case dpoint < 0
 **     reframe as: (u64mant / (5**(-dpoint)) / 2**(-dpoint)
 */
-double atod_guts (uint64_t u64mant, int dpoint)
+double emyg_atod_guts (uint64_t u64mant, int dpoint)
 {
     const uint32_t *pow5p;
     uint32_t num[BIGNUM_JUMBO_SIZE_UINT32]; // up to (log (expt 5 325) 2) = 755 bits => ~104 bytes
@@ -446,7 +450,7 @@ double atod_guts (uint64_t u64mant, int dpoint)
     if (dpoint >= 0)
     {
         int r = get_pow5(dpoint, &pow5p, &z);
-        if (r) return 0.0/0.0; // NaN for bad input -- TODO: use inf for excessive +exponents?
+        if (r) return 1.0/0.0; // beyond the table: overflow
         m = z + 2; // size is sum of lengths of multiplicands
         if (m > BIGNUM_JUMBO_SIZE_UINT32) { n = 0; goto atod_fail; }
         mulbyu64(num, u64mant, pow5p, z); // num = pow5 * u64mant
@@ -473,8 +477,11 @@ double atod_guts (uint64_t u64mant, int dpoint)
     {
         int bma = 64 - nlz64(u64mant); // bits in mantissa
         int r = get_pow5(-dpoint, &pow5p, &z);
-        if (r) return 0.0/0.0; // NaN for bad input -- TODO: use 0.0 for excessive -exponents?
+        if (r) return 0.0; // beyond the table: underflow; the caller applies the sign
         bex = bma - bitLength(pow5p, z) - doubleMantissaBits;
+        // a subnormal result has fewer bits; round at the smallest denormal
+        // instead of rounding to 53 bits and again in scalbn()
+        if (bex + dpoint < -1074) bex = -1074 - dpoint;
         if (bex > 0)
         {
             // to avoid losing significant bits, which could occur in the u64_shiftLeft below
@@ -503,9 +510,13 @@ double atod_guts (uint64_t u64mant, int dpoint)
             QUODBG(fprintf(stderr, "- bma %d bex: %d z: %d m: %d\n", bma, bex, z, m));
             u64_shiftLeft(num, u64mant, m, -bex);
             n = z;
+            // near the bottom of the subnormals the dividend can be shorter
+            // than the divisor; widen it so the quotient (0 or 1) still rounds
+            while (m < n) num[m++] = 0;
         }
         if ((m - n + 1) > BIGNUM_QUOTIENT_SIZE_UINT32) goto atod_fail;
         QUODBG(fprintf(stderr, "- n: %d m: %d q: %d\n", n, m, m - n + 1));
+        quo[1] = 0; // a subnormal quotient may be a single word
         r = quornd(quo, num, pow5p, m, n);
         if (r > 0)
         {
@@ -599,6 +610,8 @@ double emyg_strtod(const char *nptr, char **endptr)
     uint64_t mant;  // mantissa
     int minus = 0;  // mantissa minus
     int dadp = 0;   // digits after decimal point
+    int drop = 0;   // integer digits past the mantissa's precision
+    int sticky = 0; // nonzero if any ignored digit was nonzero
     int expt = 0;   // explicit exponent
     int expm = 0;   // exponent minus
     char c;
@@ -640,22 +653,8 @@ double emyg_strtod(const char *nptr, char **endptr)
         while (isdigit(c = *cp++))
         {
             uint8_t d = c - '0';
-            if (mant <= (UINT64_MAX / 10)) mant *= 10;
-            else
-            {
-                if (0 == d) expt += 1;
-                else
-                {
-                    QUODBG(fprintf(stderr, "- overlow in emyg_strtod 1\n"));
-                    goto no_conv;
-                }
-            }
-            if (mant <= (UINT64_MAX - d)) mant += d;
-            else
-            {
-                QUODBG(fprintf(stderr, "- overlow in emyg_strtod 2\n"));
-                goto no_conv;
-            }
+            if (mant <= (UINT64_MAX - d) / 10) mant = mant * 10 + d;
+            else { drop++; sticky |= d; } // ignore extra digits, keeping their scale
         }
         if ('.' == c)
         {
@@ -663,30 +662,13 @@ double emyg_strtod(const char *nptr, char **endptr)
             while (isdigit(c = *cp++))
             {
                 uint8_t d = c - '0';
-                if (mant <= (UINT64_MAX / 10)) mant *= 10;
-                else
-                {
-                    if (0 == d)
-                    {
-                        /* ignore trailing zeroes by not scaling nor bumping dadp */
-                        continue;
-                    }
-                    else
-                    {
-                        QUODBG(fprintf(stderr, "- overlow in emyg_strtod 3\n"));
-                        //goto no_conv;
-                        continue; // ignore extra digits
-                    }
-                }
-                if (mant <= (UINT64_MAX - d)) mant += d;
-                else
+                if (mant <= (UINT64_MAX - d) / 10)
                 {
-                    QUODBG(fprintf(stderr, "- overlow in emyg_strtod 4\n"));
-                    //goto no_conv;
-                    continue; // ignore extra digits
+                    mant = mant * 10 + d;
+                    dadp++;
                 }
-                dadp++;
-            }   
+                else sticky |= d; // ignore extra digits
+            }
         }
         if ('e' == c || 'E' == c)
         {
@@ -697,22 +679,11 @@ double emyg_strtod(const char *nptr, char **endptr)
 
             if (isdigit(c))
             {
-                expt += c - '0';
+                expt = c - '0';
                 while (isdigit(c = *cp++))
                 {
-                    uint8_t d = c - '0';
-                    if (expt <= (INT_MAX / 10)) expt *= 10;
-                    else
-                    {
-                        QUODBG(fprintf(stderr, "- overlow in emyg_strtod\n"));
-                        goto no_conv;
-                    }
-                    if (expt <= (INT_MAX - d)) expt += d;
-                    else
-                    {
-                        QUODBG(fprintf(stderr, "- overlow in emyg_strtod\n"));
-                        goto no_conv;
-                    }
+                    // saturate; anything this large is already 0 or inf
+                    if (expt < 100000) expt = expt * 10 + (c - '0');
                 }
             }
             else
@@ -720,15 +691,24 @@ double emyg_strtod(const char *nptr, char **endptr)
                 // oops, not an exp at all
                 c = *--cp;
                 if (('-' == c) || ('+' == c)) --cp;
-                res = 0.0;
             }
         }
         if (expm) expt = -expt;
-        res = atod_guts(mant, expt - dadp);
+        expt += drop - dadp;
+        // outside the pow5 table the result is an overflow or an underflow
+        if (0 == mant || expt < -(int )MAX_POW5_IN_TABLE) res = 0.0;
+        else if (expt > 308) res = 1.0/0.0;
+        else
+        {
+            res = emyg_atod_guts(mant, expt);
+            // the true value lies strictly between mant and mant + 1; if
+            // both round to the same double that is the answer
+            if (sticky && (mant == UINT64_MAX || res != emyg_atod_guts(mant + 1, expt)))
+                res = fabs(strtod(nptr, NULL)); // sign is applied below
+        }
     }
     else // no conversion
     {
-no_conv:
         cp = nptr + 1;
         res = 0.0;
     }
@@ -748,7 +728,7 @@ int main (int argc, char **argv)
     if ((argc == 4) && (0 == strcmp(argv[1], "-p")))
     {
         char *p;
-        double d = atod_guts(strtoull(argv[2], &p, 10), strtol(argv[3], &p, 10));
+        double d = emyg_atod_guts(strtoull(argv[2], &p, 10), strtol(argv[3], &p, 10));
         printf("%.17g  %a\n", d, d);
         return 0;
     }
@@ -764,3 +744,5 @@ int main (int argc, char **argv)
 }
 
 #endif
+
+#endif
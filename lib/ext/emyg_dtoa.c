@@ -28,6 +28,10 @@
 ** Notices 45.6 (2010): 233-243.
 */
 
+#include <picrin.h>
+
+#if PIC_USE_LIBC
+
 #include <assert.h>
 #include <math.h>
 
@@ -40,8 +44,6 @@
 
 #include <string.h>
 
-#include "emyg_dtoa.h"
-
 #define UINT64_C2(h, l) (((uint64_t )(h) << 32) | (uint64_t )(l))
 
 typedef struct DiyFp_s {
@@ -265,7 +267,11 @@ static inline unsigned CountDecimalDigit32(uint32_t n) {
 }
 
 static inline void DigitGen(const DiyFp W, const DiyFp Mp, uint64_t delta, char* buffer, int* len, int* K) {
-  static const uint32_t kPow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+  static const uint64_t kPow10[] = { 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+                                     1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+                                     10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+                                     10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+                                     10000000000000000000ULL };
   const DiyFp one = DiyFp_from_parts((uint64_t )(1) << -Mp.e, Mp.e);
   const DiyFp wp_w = DiyFp_subtract(Mp, W);
   uint32_t p1 = (uint32_t )(Mp.f >> -one.e);
@@ -301,7 +307,7 @@ static inline void DigitGen(const DiyFp W, const DiyFp Mp, uint64_t delta, char*
     uint64_t tmp = ((uint64_t )(p1) << -one.e) + p2;
     if (tmp <= delta) {
       *K += kappa;
-      GrisuRound(buffer, *len, delta, tmp, (uint64_t )(kPow10[kappa]) << -one.e, wp_w.f);
+      GrisuRound(buffer, *len, delta, tmp, kPow10[kappa] << -one.e, wp_w.f);
       return;
     }
   }
@@ -317,7 +323,7 @@ static inline void DigitGen(const DiyFp W, const DiyFp Mp, uint64_t delta, char*
     kappa--;
     if (p2 < delta) {
       *K += kappa;
-      GrisuRound(buffer, *len, delta, p2, one.f, wp_w.f * kPow10[-kappa]);
+      GrisuRound(buffer, *len, delta, p2, one.f, wp_w.f * (-kappa < 20 ? kPow10[-kappa] : 0));
       return;
     }
   }
@@ -438,3 +444,5 @@ void emyg_dtoa (double value, char* buffer) {
     Prettify(buffer, length, K);
   }
 }
+
+#endif
@@ -715,7 +715,7 @@ static const uint16_t pow5w[] = {
 };
 
 /* returns result: 0 = OK; non-zero = error */
-int get_pow5 (uint32_t exp, const uint32_t **p5, int *sz_in_32bit_words)
+static int get_pow5 (uint32_t exp, const uint32_t **p5, int *sz_in_32bit_words)
 {
     if (exp <= MAX_POW5_IN_TABLE)
     {
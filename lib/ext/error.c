@@ -20,7 +20,9 @@ pic_prepare_try(pic_state *pic)
   cxt->fp = NULL;
   cxt->sp = NULL;
   cxt->irep = NULL;
-  cxt->conts = pic_nil_value(pic);
+  cxt->foreign = false;
+  cxt->id = ++pic->cxt_id;
+  cxt->dyn_env = pic->dyn_env;
   cxt->prev = pic->cxt;
   pic->cxt = cxt;
   return &cxt->jmp;
@@ -41,7 +43,7 @@ void
 pic_enter_try(pic_state *pic)
 {
   pic_value cont, handler;
-  pic_value var, env;
+  pic_value var;
 
   pic->cxt->ai = pic->ai;
 
@@ -50,9 +52,7 @@ pic_enter_try(pic_state *pic)
   handler = pic_lambda(pic, native_exception_handler, 1, cont);
   /* with-exception-handler */
   var = pic_exc(pic);
-  env = pic_make_attr(pic);
-  pic_attr_set(pic, env, var, pic_cons(pic, handler, pic_call(pic, var, 0)));
-  pic_set(pic, "__picrin_dynenv__", pic_cons(pic, env, pic_ref(pic, "__picrin_dynenv__")));
+  pic_dynenv_bind(pic, var, pic_cons(pic, handler, pic_call(pic, var, 0)));
 
   pic_leave(pic, pic->cxt->ai);
 }
@@ -61,25 +61,24 @@ void
 pic_exit_try(pic_state *pic)
 {
   struct context *cxt = pic->cxt;
-  pic_value c, it;
-  pic_set(pic, "__picrin_dynenv__", pic_cdr(pic, pic_ref(pic, "__picrin_dynenv__")));
-  pic_for_each (c, cxt->conts, it) {
-    proc_ptr(pic, c)->env->regs[0] = pic_false_value(pic);
-  }
+  pic_dynenv_reroot(pic, cxt->dyn_env);
   pic->cxt = cxt->prev;
   pic_free(pic, cxt);
   /* don't rewind ai here */
 }
 
+void
+pic_raise(pic_state *pic, pic_value err)
+{
+  pic_funcall(pic, "raise", 1, err);
+  PIC_UNREACHABLE();
+}
+
 pic_value
 pic_abort_try(pic_state *pic)
 {
   struct context *cxt = pic->cxt;
-  pic_value c, it;
   pic_value err = cxt->sp->regs[1];
-  pic_for_each (c, cxt->conts, it) {
-    proc_ptr(pic, c)->env->regs[0] = pic_false_value(pic);
-  }
   pic->cxt = cxt->prev;
   pic_free(pic, cxt);
   pic_protect(pic, err);
@@ -90,313 +89,198 @@ pic_abort_try(pic_state *pic)
 
 #if PIC_USE_ERROR
 static const unsigned char error_rom[] = {
-0x03, 0x01, 0x00, 0x04, 0x02, 0x01, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x02, 0x00, 0x00,
-0x02, 0x01, 0x01, 0x06, 0x02, 0x00, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69,
-0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00,
-0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x70, 0x61,
-0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x04,
-0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x0b, 0x0b, 0x48, 0x00, 0x00, 0x00, 0x02, 0x1a, 0x00, 0x00, 0x00, 0x63,
-0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x65, 0x78, 0x63, 0x65, 0x70,
-0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72,
-0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x72, 0x61, 0x69, 0x73, 0x65,
-0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x72, 0x61, 0x69, 0x73, 0x65, 0x2d,
-0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x61, 0x62, 0x6c, 0x65, 0x00,
-0x02, 0x16, 0x00, 0x00, 0x00, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x65, 0x78,
-0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x61, 0x6e, 0x64,
-0x6c, 0x65, 0x72, 0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
+0x7f, 0x66, 0x73, 0x6c, 0x03, 0x1e, 0x05, 0x65, 0x72, 0x72, 0x6f, 0x72,
+0x04, 0x6c, 0x69, 0x73, 0x74, 0x0e, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x70,
+0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x1a, 0x63, 0x75, 0x72,
+0x72, 0x65, 0x6e, 0x74, 0x2d, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69,
+0x6f, 0x6e, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x05,
+0x72, 0x61, 0x69, 0x73, 0x65, 0x11, 0x72, 0x61, 0x69, 0x73, 0x65, 0x2d,
+0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x61, 0x62, 0x6c, 0x65, 0x16,
+0x77, 0x69, 0x74, 0x68, 0x2d, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69,
+0x6f, 0x6e, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x04, 0x63,
+0x6f, 0x6e, 0x73, 0x09, 0x69, 0x72, 0x72, 0x69, 0x74, 0x61, 0x6e, 0x74,
+0x73, 0x1b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79,
+0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f,
+0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x03, 0x63, 0x64, 0x72, 0x03, 0x63, 0x61,
+0x72, 0x07, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x04, 0x74, 0x79,
+0x70, 0x65, 0x10, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x72, 0x65, 0x63, 0x6f,
+0x72, 0x64, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x0c, 0x65, 0x72, 0x72, 0x6f,
+0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x11, 0x6d, 0x61, 0x6b,
 0x65, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65,
-0x63, 0x74, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f,
-0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x3f, 0x00, 0x02, 0x16,
-0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a,
-0x65, 0x63, 0x74, 0x2d, 0x69, 0x72, 0x72, 0x69, 0x74, 0x61, 0x6e, 0x74,
-0x73, 0x00, 0x02, 0x14, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72,
-0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x6d, 0x65, 0x73, 0x73,
-0x61, 0x67, 0x65, 0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72,
-0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x74, 0x79,
-0x70, 0x65, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f,
-0x72, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x64, 0x69, 0x73, 0x70, 0x6c,
-0x61, 0x79, 0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x00,
+0x63, 0x74, 0x0d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a,
+0x65, 0x63, 0x74, 0x3f, 0x16, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f,
+0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x69, 0x72, 0x72, 0x69, 0x74, 0x61,
+0x6e, 0x74, 0x73, 0x14, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62,
+0x6a, 0x65, 0x63, 0x74, 0x2d, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+0x11, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63,
+0x74, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x07, 0x64, 0x69, 0x73, 0x70, 0x6c,
+0x61, 0x79, 0x0b, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x72, 0x65, 0x63, 0x6f,
+0x72, 0x64, 0x07, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x3f, 0x0b, 0x72,
+0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x03, 0x65,
+0x71, 0x3f, 0x05, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x13, 0x63, 0x75, 0x72,
+0x72, 0x65, 0x6e, 0x74, 0x2d, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2d,
+0x70, 0x6f, 0x72, 0x74, 0x08, 0x66, 0x6f, 0x72, 0x2d, 0x65, 0x61, 0x63,
+0x68, 0x05, 0x77, 0x72, 0x69, 0x74, 0x65, 0x13, 0x11, 0x01, 0x00, 0x04,
+0x01, 0x02, 0x0b, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x06,
+0x02, 0x00, 0x01, 0x02, 0x1a, 0x2d, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x0a, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x02, 0x01, 0x02, 0x1a, 0x16, 0x11, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x0a, 0x02, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x1a, 0xb4, 0x0e, 0x11, 0x01, 0x00, 0x05, 0x06, 0x04,
+0x26, 0x0a, 0x03, 0x0a, 0x04, 0x0a, 0x05, 0x0a, 0x06, 0x0a, 0x07, 0x0a,
+0x08, 0x04, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07,
+0x00, 0x01, 0x02, 0x00, 0x01, 0x07, 0x00, 0x02, 0x02, 0x00, 0x02, 0x07,
+0x00, 0x03, 0x06, 0x00, 0x04, 0x02, 0x01, 0x03, 0x03, 0x02, 0x05, 0x0b,
+0x03, 0x01, 0x03, 0x1a, 0x9e, 0x02, 0x11, 0x02, 0x00, 0x03, 0x01, 0x01,
+0x08, 0x0a, 0x03, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a,
+0x8a, 0x02, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xf3,
+0x01, 0x11, 0x02, 0x00, 0x03, 0x01, 0x01, 0x08, 0x0a, 0x09, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0xdf, 0x01, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xc8, 0x01, 0x11, 0x02, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x0a, 0x0a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x01, 0x02, 0x1a, 0xb0, 0x01, 0x11, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x0a, 0x03, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x98, 0x01, 0x11, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x0a, 0x0b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x02, 0x01, 0x02, 0x1a, 0x80, 0x01, 0x11, 0x01, 0x00, 0x04,
+0x00, 0x01, 0x0d, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x07, 0x02, 0x01, 0x02, 0x1a, 0x6a, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01,
+0x0f, 0x0a, 0x00, 0x08, 0x10, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x08, 0x02, 0x01, 0x03,
+0x1a, 0x3e, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x28,
+0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x09, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x1a, 0x11, 0x11,
+0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01,
+0x01, 0x02, 0x01, 0x01, 0x1a, 0xf0, 0x01, 0x11, 0x02, 0x00, 0x03, 0x01,
+0x01, 0x08, 0x0a, 0x03, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x1a, 0xdc, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0xc5, 0x01, 0x11, 0x02, 0x00, 0x03, 0x01, 0x01, 0x08, 0x0a, 0x09, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0xb1, 0x01, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x9a, 0x01, 0x11, 0x02, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x0a, 0x0a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x1a, 0x82, 0x01, 0x11, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x0a, 0x03, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x6b, 0x11, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x0a, 0x0b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x02, 0x01, 0x02, 0x1a, 0x54, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x01, 0x0d, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07,
+0x02, 0x01, 0x02, 0x1a, 0x3e, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x28, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x09,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02,
+0x1a, 0x11, 0x11, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x01,
+0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x1a, 0xd8, 0x01, 0x11, 0x03,
+0x00, 0x03, 0x01, 0x01, 0x08, 0x0a, 0x03, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x01, 0x01, 0x1a, 0xc4, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01,
+0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x1a, 0xad, 0x01, 0x11, 0x02, 0x00, 0x03, 0x01, 0x01, 0x08,
+0x0a, 0x09, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0x99,
+0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x82, 0x01,
+0x11, 0x02, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x07, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x02, 0x02, 0x01,
+0x03, 0x1a, 0x67, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x03,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x1a, 0x50, 0x11, 0x01, 0x00, 0x03, 0x00, 0x01, 0x09, 0x04, 0x00, 0x06,
+0x03, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0x3e, 0x11, 0x01, 0x00, 0x04,
+0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0x28, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x0a, 0x09, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
+0x02, 0x01, 0x02, 0x1a, 0x11, 0x11, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a,
+0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x1a, 0x89,
+0x08, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x07, 0x0a, 0x0c,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0xec, 0x07, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01,
+0x0f, 0x0a, 0x07, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xcf, 0x07, 0x11,
+0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0e, 0x0a, 0x0f, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x1a, 0xb2, 0x07, 0x11, 0x01, 0x00, 0x04, 0x08, 0x08, 0x36, 0x0a,
+0x0f, 0x0a, 0x10, 0x0a, 0x11, 0x0a, 0x12, 0x0a, 0x13, 0x0a, 0x14, 0x0a,
+0x00, 0x0a, 0x15, 0x04, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x00,
 0x00, 0x07, 0x00, 0x01, 0x02, 0x00, 0x01, 0x07, 0x00, 0x02, 0x02, 0x00,
 0x02, 0x07, 0x00, 0x03, 0x02, 0x00, 0x03, 0x07, 0x00, 0x04, 0x02, 0x00,
 0x04, 0x07, 0x00, 0x05, 0x02, 0x00, 0x05, 0x07, 0x00, 0x06, 0x02, 0x00,
-0x06, 0x07, 0x00, 0x07, 0x02, 0x00, 0x07, 0x07, 0x00, 0x08, 0x02, 0x00,
-0x08, 0x07, 0x00, 0x09, 0x02, 0x00, 0x09, 0x02, 0x01, 0x0a, 0x06, 0x02,
-0x0a, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00,
-0x02, 0x1a, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
-0x2d, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68,
-0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02,
-0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x61, 0x74, 0x74,
-0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00,
-0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
-0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76,
-0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
-0x04, 0x03, 0x00, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72,
-0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d,
-0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x1a, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72,
-0x65, 0x6e, 0x74, 0x2d, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f,
-0x6e, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x20,
-0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x0b, 0x02, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00,
-0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61,
-0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d,
-0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x08, 0x03, 0x01, 0x02, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
-0x00, 0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x1a, 0x00, 0x00,
-0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x65, 0x78, 0x63,
-0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x6c,
-0x65, 0x72, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
-0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00,
-0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
-0x74, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
-0x00, 0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00,
-0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e,
-0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e,
-0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01,
-0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x03, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
-0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69,
-0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
-0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x1a, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
-0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x61,
-0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
-0x01, 0x06, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63,
-0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d,
-0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65,
-0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07,
-0x03, 0x01, 0x02, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x00,
-0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x1a, 0x00, 0x00, 0x00,
-0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x65, 0x78, 0x63, 0x65,
-0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65,
-0x72, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
-0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03,
-0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x6b, 0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
-0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00,
-0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61,
-0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d,
-0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01,
-0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x03, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b,
-0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64,
-0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72,
-0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02,
-0x04, 0x03, 0x05, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x1a, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72,
-0x65, 0x6e, 0x74, 0x2d, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f,
-0x6e, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x03,
-0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
-0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76,
-0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x00, 0x03,
-0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01,
-0x01, 0x02, 0x01, 0x01, 0x04, 0x00, 0x06, 0x01, 0x01, 0x14, 0x00, 0x00,
-0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04,
-0x03, 0x00, 0x03, 0x04, 0x04, 0x00, 0x04, 0x01, 0x04, 0x01, 0x00, 0x05,
-0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x6b, 0x65, 0x2d, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x00, 0x02,
-0x0c, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62,
-0x6a, 0x65, 0x63, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
-0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x72,
-0x65, 0x63, 0x6f, 0x72, 0x64, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x1c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63,
-0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00,
-0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x03, 0x03, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72,
-0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x3f, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x06,
-0x01, 0x04, 0x27, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x72,
-0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d, 0x00,
-0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01,
-0x14, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x74,
-0x79, 0x70, 0x65, 0x20, 0x6d, 0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68,
-0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d,
-0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
-0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02,
-0x02, 0x04, 0x03, 0x01, 0x02, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x00,
-0x05, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00,
-0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03,
-0x02, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x0d, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f,
-0x62, 0x6a, 0x65, 0x63, 0x74, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01, 0x04,
-0x27, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63,
-0x6f, 0x72, 0x64, 0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x14, 0x00,
-0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x74, 0x79, 0x70,
-0x65, 0x20, 0x6d, 0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x02,
-0x0c, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62,
-0x6a, 0x65, 0x63, 0x74, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01,
-0x02, 0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x04,
-0x03, 0x01, 0x02, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x00, 0x05, 0x00,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x76, 0x65,
-0x63, 0x74, 0x6f, 0x72, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x01, 0x01,
-0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0d,
-0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a,
-0x65, 0x63, 0x74, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01, 0x04, 0x27, 0x00,
-0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72,
-0x64, 0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d, 0x00, 0x02, 0x05, 0x00, 0x00,
-0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20,
-0x6d, 0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x02, 0x0c, 0x00,
-0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65,
-0x63, 0x74, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06,
-0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x01,
-0x02, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x00, 0x05, 0x00, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74,
-0x6f, 0x72, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x02,
-0x01, 0x06, 0x01, 0x01, 0x12, 0x00, 0x00, 0x00, 0x02, 0x11, 0x00, 0x00,
-0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d,
-0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x0a, 0x02, 0x04, 0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x03, 0x01,
-0x04, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x72, 0x61, 0x69, 0x73, 0x65, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
-0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02,
-0x01, 0x00, 0x01, 0x01, 0x02, 0x01, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e,
-0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x02, 0x1e, 0x00,
-0x00, 0x00, 0x02, 0x12, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65,
-0x6e, 0x74, 0x2d, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x70, 0x6f, 0x72,
-0x74, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x0d, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x01, 0x01, 0x01, 0x01, 0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04,
-0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x0d, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f,
-0x62, 0x6a, 0x65, 0x63, 0x74, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
-0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0d, 0x00,
-0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x04,
-0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x01,
-0x02, 0x01, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x65, 0x72,
-0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x74,
-0x79, 0x70, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00,
-0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d,
-0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01,
-0x0c, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x08, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x04, 0x03, 0x05, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
-0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x04, 0x00,
-0x09, 0x02, 0x04, 0x01, 0x03, 0x01, 0x03, 0x02, 0x00, 0x04, 0x03, 0x06,
-0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3a, 0x20,
-0x22, 0x00, 0x04, 0x00, 0x06, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
-0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x14, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f,
-0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x6d, 0x65, 0x73,
-0x73, 0x61, 0x67, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x08, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x04, 0x03, 0x05, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x04,
-0x00, 0x09, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x16, 0x00, 0x00,
-0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63,
-0x74, 0x2d, 0x69, 0x72, 0x72, 0x69, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00,
-0x00, 0x00, 0x66, 0x6f, 0x72, 0x2d, 0x65, 0x61, 0x63, 0x68, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x01,
-0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x0c, 0x02, 0x04, 0x01,
-0x07, 0x01, 0x03, 0x02, 0x00, 0x04, 0x03, 0x09, 0x02, 0x01, 0x03, 0x02,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
-0x00, 0x20, 0x00, 0x04, 0x00, 0x0c, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
-0x00, 0x04, 0x03, 0x09, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x77, 0x72, 0x69,
-0x74, 0x65, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02,
-0x01, 0x02, 0x04, 0x03, 0x0a, 0x02, 0x01, 0x03, 0x01, 0x00, 0x03, 0x00,
-0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x64, 0x69,
-0x73, 0x70, 0x6c, 0x61, 0x79, 0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0x00,
-0x00, 0x04, 0x00, 0x02, 0x01, 0x0c, 0x01, 0x01, 0x01, 
+0x06, 0x02, 0x01, 0x07, 0x06, 0x02, 0x07, 0x01, 0x02, 0x1a, 0x23, 0x11,
+0x04, 0x00, 0x07, 0x02, 0x00, 0x18, 0x0a, 0x16, 0x0a, 0x0f, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x00, 0x01, 0x06, 0x02, 0x01, 0x04, 0x03, 0x00, 0x02,
+0x04, 0x04, 0x00, 0x03, 0x04, 0x05, 0x00, 0x04, 0x01, 0x05, 0x1a, 0x59,
+0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x17, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0x42, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a, 0x18, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x01, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x1a, 0x1b, 0x11, 0x01, 0x00, 0x05, 0x02, 0x00, 0x10, 0x0a, 0x19, 0x0a,
+0x0f, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x06, 0x03, 0x01, 0x01, 0x03, 0x1a, 0x19, 0x11, 0x02, 0x00, 0x03, 0x01,
+0x00, 0x10, 0x0a, 0x0f, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
+0x06, 0x02, 0x00, 0x0e, 0x01, 0x02, 0x01, 0x01, 0x1a, 0x19, 0x11, 0x02,
+0x00, 0x03, 0x01, 0x00, 0x10, 0x0a, 0x0f, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x00, 0x02, 0x06, 0x02, 0x00, 0x0e, 0x01, 0x01, 0x01, 0x01, 0x1a,
+0x19, 0x11, 0x02, 0x00, 0x03, 0x01, 0x00, 0x10, 0x0a, 0x0f, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x06, 0x02, 0x00, 0x0e, 0x01, 0x00,
+0x01, 0x01, 0x1a, 0x33, 0x11, 0x02, 0x01, 0x06, 0x01, 0x01, 0x12, 0x0a,
+0x10, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0a, 0x02, 0x04, 0x03, 0x00,
+0x02, 0x04, 0x04, 0x00, 0x03, 0x01, 0x04, 0x1a, 0x16, 0x11, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x0a, 0x04, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xc2, 0x04, 0x11, 0x02,
+0x00, 0x03, 0x00, 0x01, 0x09, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+0x01, 0x01, 0x1a, 0xaf, 0x04, 0x11, 0x02, 0x01, 0x03, 0x00, 0x02, 0x08,
+0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x40, 0x11, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x1a, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x01, 0x03, 0x01, 0x02, 0x1a, 0x29, 0x11, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x1e, 0x0a, 0x1b, 0x0a, 0x0b, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x0d, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x02, 0x03,
+0x01, 0x02, 0x1a, 0xdb, 0x03, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0xc4, 0x03, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a,
+0x11, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01,
+0x02, 0x1a, 0xac, 0x03, 0x11, 0x01, 0x00, 0x05, 0x00, 0x01, 0x23, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x04, 0x02, 0x04, 0x01, 0x01, 0x01,
+0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x1a, 0xff,
+0x02, 0x11, 0x01, 0x00, 0x03, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x01, 0x01, 0x1a, 0x73, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x0a, 0x14, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05,
+0x02, 0x01, 0x02, 0x1a, 0x5c, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c,
+0x0a, 0x14, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x04, 0x00,
+0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0x35, 0x11, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x04, 0x00, 0x08, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x04, 0x03, 0x05, 0x02, 0x01, 0x03, 0x1a, 0x1b, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x08, 0x01, 0x2d, 0x04, 0x00, 0x09, 0x02,
+0x04, 0x01, 0x03, 0x01, 0x03, 0x02, 0x00, 0x04, 0x03, 0x06, 0x02, 0x01,
+0x03, 0x1a, 0xf8, 0x01, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x08,
+0x08, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3a, 0x20, 0x22, 0x04, 0x00, 0x06,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x04, 0x03, 0x03, 0x02, 0x01,
+0x03, 0x1a, 0xd4, 0x01, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a,
+0x13, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01,
+0x02, 0x1a, 0xbc, 0x01, 0x11, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x04,
+0x00, 0x08, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03,
+0x05, 0x02, 0x01, 0x03, 0x1a, 0xa1, 0x01, 0x11, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x08, 0x01, 0x22, 0x04, 0x00, 0x09, 0x02, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x00, 0x04, 0x03, 0x06, 0x02, 0x01, 0x03, 0x1a, 0x84, 0x01,
+0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x12, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x1a, 0x6d, 0x11,
+0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a, 0x1c, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0x1b, 0x11, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x08, 0x01, 0x0a, 0x04,
+0x00, 0x0c, 0x02, 0x04, 0x01, 0x07, 0x01, 0x03, 0x02, 0x00, 0x04, 0x03,
+0x09, 0x02, 0x01, 0x03, 0x1a, 0x36, 0x11, 0x02, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x08, 0x01, 0x20, 0x04, 0x00, 0x0c, 0x02, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x00, 0x04, 0x03, 0x09, 0x02, 0x01, 0x03, 0x1a, 0x1a, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x1d, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x0a, 0x02, 0x01, 0x03,
+0x1a, 0x18, 0x11, 0x01, 0x00, 0x03, 0x01, 0x00, 0x0f, 0x0a, 0x15, 0x04,
+0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x04, 0x00, 0x06, 0x01, 0x0c, 0x01,
+0x01, 0x01, 0x00, 
 };
 #endif
 
@@ -404,6 +288,6 @@ void
 pic_init_error(pic_state *PIC_UNUSED(pic))
 {
 #if PIC_USE_ERROR
-  pic_call(pic, pic_deserialize(pic, pic_blob_value(pic, error_rom, sizeof error_rom)), 0);
+  pic_call(pic, pic_deserialize_static(pic, error_rom, sizeof error_rom, pic_false_value(pic)), 0);
 #endif
 }
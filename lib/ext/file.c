@@ -65,6 +65,12 @@ file_close(pic_state *PIC_UNUSED(pic), void *cookie) {
   return fclose(cookie);
 }
 
+/* the standard streams outlive any one state */
+static int
+std_close(pic_state *PIC_UNUSED(pic), void *cookie) {
+  return fflush(cookie);
+}
+
 pic_value
 pic_fopen(pic_state *pic, FILE *fp, const char *mode) {
   static const pic_port_type file_rd = { file_read, 0, file_seek, file_close };
@@ -183,11 +189,13 @@ pic_file_delete(pic_state *pic)
 void
 pic_init_file(pic_state *pic)
 {
+  static const pic_port_type std_rd = { file_read, 0, file_seek, std_close };
+  static const pic_port_type std_wr = { 0, file_write, file_seek, std_close };
   pic_value i, o, e;
 
-  i = pic_fopen(pic, stdin, "r");
-  o = pic_fopen(pic, stdout, "w");
-  e = pic_fopen(pic, stderr, "w");
+  i = pic_funopen(pic, stdin, &std_rd);
+  o = pic_funopen(pic, stdout, &std_wr);
+  e = pic_funopen(pic, stderr, &std_wr);
   pic_setvbuf(pic, i, NULL, PIC_IOLBF, 0);
   pic_setvbuf(pic, o, NULL, PIC_IOLBF, 0);
   pic_defvar(pic, "current-input-port", i);
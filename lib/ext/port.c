@@ -4,6 +4,8 @@
 
 #include <picrin.h>
 #include <picrin/extra.h>
+#include "../value.h"
+#include "../object.h"
 
 #if PIC_USE_PORT
 
@@ -38,13 +40,16 @@ struct port {
 
 static int flushbuf(pic_state *, int, struct port *);
 
+static const pic_port_type strbuf_type;
+
 static void
 port_dtor(pic_state *pic, void *port)
 {
   struct port *fp = port;
   if (fp->flag == 0)
     return;
-  if ((fp->flag & FILE_WRITE) != 0 && fp->base != NULL)
+  /* a string builder cannot allocate while the GC is sweeping */
+  if ((fp->flag & FILE_WRITE) != 0 && fp->base != NULL && fp->vtable != &strbuf_type)
     flushbuf(pic, EOF, fp);
   if (fp->base != fp->buf && (fp->flag & FILE_SETBUF) == 0)
     pic_free(pic, fp->base);
@@ -52,7 +57,19 @@ port_dtor(pic_state *pic, void *port)
   pic_free(pic, port);
 }
 
-static const pic_data_type port_type = { "port", port_dtor };
+static void
+port_mark(pic_state *pic, void *port, void (*mark)(pic_state *, pic_value))
+{
+  struct port *fp = port;
+  pic_strbuf *sb;
+  if (fp->flag == 0 || fp->vtable != &strbuf_type)
+    return;
+  sb = fp->cookie;
+  mark(pic, sb->str);
+  mark(pic, sb->chunk);
+}
+
+static const pic_data_type port_type = { "port", port_dtor, port_mark };
 
 pic_value
 pic_funopen(pic_state *pic, void *cookie, const pic_port_type *type)
@@ -311,6 +328,25 @@ pic_ungetc(pic_state *pic, int c, pic_value port)
   return *--fp->ptr = uc;
 }
 
+const char *
+pic_fpeekbuf(pic_state *pic, pic_value port, int *len)
+{
+  struct port *fp = pic_data(pic, port);
+
+  *len = (fp->flag & FILE_READ) ? (int) fp->cnt : 0;
+  return fp->ptr;
+}
+
+void
+pic_fskipbuf(pic_state *pic, pic_value port, int n)
+{
+  struct port *fp = pic_data(pic, port);
+
+  assert(0 <= n && n <= fp->cnt);
+  fp->ptr += n;
+  fp->cnt -= n;
+}
+
 size_t
 pic_fread(pic_state *pic, void *ptr, size_t size, size_t count, pic_value port)
 {
@@ -346,11 +382,21 @@ pic_fwrite(pic_state *pic, const void *ptr, size_t size, size_t count, pic_value
 
   nbytes = size * count;
   while (nbytes > fp->cnt) {
+    if (fp->flag & FILE_UNBUF) {
+      if (flushbuf(pic, (unsigned char) *bptr, fp) == EOF) {
+        return (size * count - nbytes) / size;
+      }
+      bptr++;
+      nbytes--;
+      continue;
+    }
     memcpy(fp->ptr, bptr, fp->cnt);
     fp->ptr += fp->cnt;
     bptr += fp->cnt;
     nbytes -= fp->cnt;
-    if (flushbuf(pic, EOF, fp) == EOF) {
+    /* flushbuf(EOF) returns EOF on success too */
+    flushbuf(pic, EOF, fp);
+    if ((fp->flag & (FILE_WRITE|FILE_EOF|FILE_ERR)) != FILE_WRITE) {
       return (size * count - nbytes) / size;
     }
   }
@@ -467,7 +513,7 @@ string_close(pic_state *pic, void *cookie)
   return 0;
 }
 
-static pic_value
+pic_value
 pic_fmemopen(pic_state *pic, const char *data, int size, const char *mode)
 {
   static const pic_port_type string_rd = { string_read, 0, string_seek, string_close };
@@ -488,6 +534,48 @@ pic_fmemopen(pic_state *pic, const char *data, int size, const char *mode)
   }
 }
 
+static int
+strbuf_write(pic_state *pic, void *cookie, const char *ptr, int size)
+{
+  pic_strbuf_write(pic, cookie, ptr, size);
+  return size;
+}
+
+static long
+strbuf_seek(pic_state *PIC_UNUSED(pic), void *PIC_UNUSED(cookie), long PIC_UNUSED(pos), int PIC_UNUSED(whence))
+{
+  return -1;
+}
+
+static int
+strbuf_close(pic_state *pic, void *cookie)
+{
+  pic_free(pic, cookie);
+  return 0;
+}
+
+static const pic_port_type strbuf_type = { 0, strbuf_write, strbuf_seek, strbuf_close };
+
+static pic_value
+pic_strbuf_open(pic_state *pic)
+{
+  pic_strbuf *sb;
+
+  sb = pic_malloc(pic, sizeof(pic_strbuf));
+  pic_strbuf_init(pic, sb);
+  return pic_funopen(pic, sb, &strbuf_type);
+}
+
+static pic_value
+pic_strbuf_get(pic_state *pic, pic_value port)
+{
+  struct port *fp = pic_data(pic, port);
+
+  pic_fflush(pic, port);
+
+  return pic_strbuf_snapshot(pic, fp->cookie);
+}
+
 static int
 pic_fgetbuf(pic_state *pic, pic_value port, const char **buf, int *len)
 {
@@ -649,7 +737,10 @@ pic_port_get_output_bytevector(pic_state *pic)
 
   check_port_type(pic, port, FILE_WRITE);
 
-  if (pic_fgetbuf(pic, port, &buf, &len) < 0) {
+  if (pic_port_p(pic, port, &strbuf_type)) {
+    buf = pic_str(pic, pic_strbuf_get(pic, port), &len);
+  }
+  else if (pic_fgetbuf(pic, port, &buf, &len) < 0) {
     pic_error(pic, "port was not created by open-output-bytevector", 0);
   }
   return pic_blob_value(pic, (unsigned char *)buf, len);
@@ -674,7 +765,7 @@ pic_port_open_output_string(pic_state *pic)
 {
   pic_get_args(pic, "");
 
-  return pic_fmemopen(pic, NULL, 0, "w");
+  return pic_strbuf_open(pic);
 }
 
 static pic_value
@@ -688,6 +779,9 @@ pic_port_get_output_string(pic_state *pic)
 
   check_port_type(pic, port, FILE_WRITE);
 
+  if (pic_port_p(pic, port, &strbuf_type)) {
+    return pic_strbuf_get(pic, port);
+  }
   if (pic_fgetbuf(pic, port, &buf, &len) < 0) {
     pic_error(pic, "port was not created by open-output-string", 0);
   }
@@ -817,50 +911,76 @@ pic_port_read_bytevector(pic_state *pic)
 static pic_value
 pic_port_read_string(pic_state *pic)
 {
-  pic_value port = pic_stdin(pic), blob;
-  int n, k, i;
+  pic_value port = pic_stdin(pic);
+  int k, i;
   char *buf;
 
-  n = pic_get_args(pic, "i|o", &k, &port);
+  pic_get_args(pic, "i|o", &k, &port);
 
   check_port_type(pic, port, FILE_READ);
 
-  buf = pic_malloc(pic, k);
+  if (k < 0) {
+    pic_error(pic, "read-string: negative length given", 1, pic_int_value(pic, k));
+  }
+
+  buf = pic_malloc(pic, k + 1);
 
   i = pic_fread(pic, buf, 1, k, port);
-  if (i == 0) {
+  if (i == 0 && k != 0) {
     pic_free(pic, buf);
     return pic_eof_object(pic);
   }
-  blob = pic_str_value(pic, buf, i);
-  pic_free(pic, buf);
-  return blob;
+  if (i < k) {
+    buf = pic_realloc(pic, buf, i + 1);
+  }
+  buf[i] = '\0';
+  return pic_make_str(pic, buf, i);
 }
 
 static pic_value
 pic_port_read_line(pic_state *pic)
 {
-  pic_value port = pic_stdin(pic), str;
-  int c;
-  char s[1];
+  pic_value port = pic_stdin(pic);
+  struct port *fp;
+  char *buf = NULL, *nl = NULL;
+  long len = 0, capa = 0, n;
 
   pic_get_args(pic, "|o", &port);
 
   check_port_type(pic, port, FILE_READ);
 
-  if ((c = pic_fgetc(pic, port)) == EOF) {
-    return pic_eof_object(pic);
+  fp = pic_data(pic, port);
+
+  /* scan the port buffer chunk by chunk instead of calling getc per byte */
+  while (nl == NULL) {
+    if (fp->cnt <= 0) {
+      if (fillbuf(pic, fp) == EOF)
+        break;
+      fp->ptr--;                /* push back the character fillbuf consumed */
+      fp->cnt++;
+    }
+    nl = memchr(fp->ptr, '\n', fp->cnt);
+    n = nl ? nl - fp->ptr : fp->cnt;
+    if (len + n + 1 > capa) {
+      capa = (len + n + 1) * 2;
+      buf = pic_realloc(pic, buf, capa);
+    }
+    memcpy(buf + len, fp->ptr, n);
+    len += n;
+    fp->ptr += n;
+    fp->cnt -= n;
+    if (nl) {
+      fp->ptr++;                /* drop the newline */
+      fp->cnt--;
+    }
   }
-  s[0] = c;
-  str = pic_str_value(pic, s, 1);
 
-  while ((c = pic_fgetc(pic, port)) != EOF) {
-    if (c == '\n')
-      break;
-    s[0] = c;
-    str = pic_str_cat(pic, str, pic_str_value(pic, s, 1));
+  if (buf == NULL) {
+    return pic_eof_object(pic);
   }
-  return str;
+  buf = pic_realloc(pic, buf, len + 1);
+  buf[len] = '\0';
+  return pic_make_str(pic, buf, len);
 }
 
 static pic_value
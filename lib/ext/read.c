@@ -25,8 +25,8 @@ struct reader_control {
 
 typedef pic_value (*pic_reader_t)(pic_state *, pic_value port, int c, struct reader_control *);
 
-static pic_reader_t reader_table[256];
-static pic_reader_t reader_dispatch[256];
+static pic_reader_t reader_table(int c);
+static pic_reader_t reader_dispatch(int c);
 
 static pic_value read_core(pic_state *pic, pic_value port, int c, struct reader_control *p);
 static pic_value read_nullable(pic_state *pic, pic_value port, int c, struct reader_control *p);
@@ -217,47 +217,112 @@ read_syntax_unquote(pic_state *pic, pic_value port, int PIC_UNUSED(c), struct re
   return pic_list(pic, 2, tag, read_core(pic, port, next(pic, port), p));
 }
 
-static pic_value
-read_atom(pic_state *pic, pic_value port, int c, struct reader_control *p) {
-  int len;
-  char *buf;
-  pic_value str;
-
-  len = 1;
-  buf = pic_malloc(pic, len + 1);
-  buf[0] = case_fold(c, p);
-  buf[1] = 0;
+/*
+ * Scans an atom starting with c. When the whole token is already in the
+ * port buffer it is returned in place; otherwise (or when the case has
+ * to be folded) it is collected into *spill, which the caller frees.
+ */
+static const char *
+read_token(pic_state *pic, pic_value port, int c, struct reader_control *p, char **spill, int *len)
+{
+  const char *buf;
+  char *tmp;
+  int n, i, size;
+
+  *spill = NULL;
+
+  if (p->typecase == CASE_DEFAULT && pic_ungetc(pic, c, port) != EOF) {
+    buf = pic_fpeekbuf(pic, port, &n);
+    for (i = 1; i < n && ! isdelim((unsigned char) buf[i]); ++i)
+      ;
+    if (i < n) {
+      pic_fskipbuf(pic, port, i);
+      *len = i;
+      return buf;
+    }
+    /* crosses the end of the buffer */
+    size = n * 2;
+    tmp = pic_malloc(pic, size);
+    memcpy(tmp, buf, n);
+    pic_fskipbuf(pic, port, n);
+  } else {
+    size = 32;
+    tmp = pic_malloc(pic, size);
+    tmp[0] = case_fold(c, p);
+    i = 1;
+  }
 
   while (! isdelim(peek(pic, port))) {
-    c = next(pic, port);
-    len += 1;
-    buf = pic_realloc(pic, buf, len + 1);
-    buf[len - 1] = case_fold(c, p);
-    buf[len] = 0;
+    if (i >= size) {
+      tmp = pic_realloc(pic, tmp, size *= 2);
+    }
+    tmp[i++] = case_fold(next(pic, port), p);
   }
 
-  str = pic_str_value(pic, buf, len);
-  pic_free(pic, buf);
-
-  return str;
+  *spill = tmp;
+  *len = i;
+  return tmp;
 }
 
 static pic_value
 read_symbol(pic_state *pic, pic_value port, int c, struct reader_control *p)
 {
-  return pic_intern(pic, read_atom(pic, port, c, p));
+  const char *str;
+  char *spill;
+  int len;
+  pic_value sym;
+
+  str = read_token(pic, port, c, p, &spill, &len);
+  sym = pic_intern_str(pic, str, len);
+  pic_free(pic, spill);
+
+  return sym;
 }
 
 static pic_value
 read_number(pic_state *pic, pic_value port, int c, struct reader_control *p)
 {
-  pic_value str = read_atom(pic, port, c, p), num;
+  const char *str;
+  char *spill;
+  int len;
+  pic_value num;
 
-  num = pic_funcall(pic, "string->number", 1, str);
-  if (! pic_false_p(pic, num)) {
-    return num;
+  str = read_token(pic, port, c, p, &spill, &len);
+  num = pic_str_to_number(pic, str, len, 10);
+  if (pic_false_p(pic, num)) {
+    num = pic_intern_str(pic, str, len);
   }
-  return pic_intern(pic, str);
+  pic_free(pic, spill);
+
+  return num;
+}
+
+static pic_value
+read_prefixed_number(pic_state *pic, pic_value port, int c, struct reader_control *p)
+{
+  const char *str;
+  char *spill, buf[64], *tmp;
+  int len;
+  pic_value num;
+
+  str = read_token(pic, port, c, p, &spill, &len);
+  tmp = len + 1 < (int) sizeof buf ? buf : pic_malloc(pic, len + 1);
+  tmp[0] = '#';
+  memcpy(tmp + 1, str, len);
+  pic_free(pic, spill);
+
+  num = pic_str_to_number(pic, tmp, len + 1, 10);
+  if (pic_false_p(pic, num)) {
+    num = pic_str_value(pic, tmp, len + 1);
+  }
+  if (tmp != buf) {
+    pic_free(pic, tmp);
+  }
+  if (pic_str_p(pic, num)) {
+    read_error(pic, "invalid numeric literal", 1, num);
+  }
+
+  return num;
 }
 
 static unsigned
@@ -632,11 +697,11 @@ read_dispatch(pic_state *pic, pic_value port, int c, struct reader_control *p)
     read_error(pic, "unexpected EOF", 0);
   }
 
-  if (reader_dispatch[c] == NULL) {
+  if (reader_dispatch(c) == NULL) {
     read_error(pic, "invalid character at the seeker head", 1, pic_char_value(pic, c));
   }
 
-  return reader_dispatch[c](pic, port, c, p);
+  return reader_dispatch(c)(pic, port, c, p);
 }
 
 static pic_value
@@ -648,11 +713,11 @@ read_nullable(pic_state *pic, pic_value port, int c, struct reader_control *p)
     read_error(pic, "unexpected EOF", 0);
   }
 
-  if (reader_table[c] == NULL) {
+  if (reader_table(c) == NULL) {
     read_error(pic, "invalid character at the seeker head", 1, pic_char_value(pic, c));
   }
 
-  return reader_table[c](pic, port, c, p);
+  return reader_table(c)(pic, port, c, p);
 }
 
 static pic_value
@@ -671,53 +736,54 @@ read_core(pic_state *pic, pic_value port, int c, struct reader_control *p)
   return val;
 }
 
-static void
-reader_table_init(void)
-{
-  int c;
-
-  for (c = 0; c < 256; ++c) {
-    reader_table[c] = NULL;
-  }
-  for (c = 0; c < 256; ++c) {
-    reader_dispatch[c] = NULL;
-  }
-
-  /* default reader */
-  for (c = 1; c < 256; ++c) {
-    reader_table[c] = read_symbol;
-  }
+/* the tables are code rather than data, so that states need not set them up */
 
-  reader_table[')'] = read_unmatch;
-  reader_table[';'] = read_comment;
-  reader_table['\''] = read_quote;
-  reader_table['`'] = read_quasiquote;
-  reader_table[','] = read_unquote;
-  reader_table['"'] = read_string;
-  reader_table['|'] = read_pipe;
-  reader_table['('] = read_pair;
-  reader_table['#'] = read_dispatch;
-  reader_table['+'] = read_number;
-  reader_table['-'] = read_number;
-  for (c = '0'; c <= '9'; ++c) {
-    reader_table[c] = read_number;
+static pic_reader_t
+reader_table(int c)
+{
+  switch (c) {
+  case 0: return NULL;
+  case ')': return read_unmatch;
+  case ';': return read_comment;
+  case '\'': return read_quote;
+  case '`': return read_quasiquote;
+  case ',': return read_unquote;
+  case '"': return read_string;
+  case '|': return read_pipe;
+  case '(': return read_pair;
+  case '#': return read_dispatch;
+  case '+': case '-': case '.':
+  case '0': case '1': case '2': case '3': case '4':
+  case '5': case '6': case '7': case '8': case '9':
+    return read_number;
+  default:
+    return read_symbol;
   }
+}
 
-  reader_dispatch['!'] = read_directive;
-  reader_dispatch['|'] = read_block_comment;
-  reader_dispatch[';'] = read_datum_comment;
-  reader_dispatch['t'] = read_true;
-  reader_dispatch['f'] = read_false;
-  reader_dispatch['\''] = read_syntax_quote;
-  reader_dispatch['`'] = read_syntax_quasiquote;
-  reader_dispatch[','] = read_syntax_unquote;
-  reader_dispatch['\\'] = read_char;
-  reader_dispatch['('] = read_vector;
-  reader_dispatch['u'] = read_undef_or_blob;
-
-  /* read labels */
-  for (c = '0'; c <= '9'; ++c) {
-    reader_dispatch[c] = read_label;
+static pic_reader_t
+reader_dispatch(int c)
+{
+  switch (c) {
+  case '!': return read_directive;
+  case '|': return read_block_comment;
+  case ';': return read_datum_comment;
+  case 't': return read_true;
+  case 'f': return read_false;
+  case '\'': return read_syntax_quote;
+  case '`': return read_syntax_quasiquote;
+  case ',': return read_syntax_unquote;
+  case '\\': return read_char;
+  case '(': return read_vector;
+  case 'u': return read_undef_or_blob;
+  case 'b': case 'o': case 'd': case 'x': case 'e': case 'i':
+  case 'B': case 'O': case 'D': case 'X': case 'E': case 'I':
+    return read_prefixed_number;
+  case '0': case '1': case '2': case '3': case '4':
+  case '5': case '6': case '7': case '8': case '9':
+    return read_label;
+  default:
+    return NULL;
   }
 }
 
@@ -734,7 +800,7 @@ static struct reader_control *
 make_reader_control(pic_state *pic)
 {
   struct reader_control *p;
-  static const pic_data_type t = { "pic_reader_control", destroy_reader_control };
+  static const pic_data_type t = { "pic_reader_control", destroy_reader_control, NULL };
 
   p = pic_malloc(pic, sizeof *p);
   p->typecase = CASE_DEFAULT;
@@ -746,9 +812,8 @@ make_reader_control(pic_state *pic)
 }
 
 static pic_value
-read_value(pic_state *pic, pic_value port)
+read_with(pic_state *pic, pic_value port, struct reader_control *p)
 {
-  struct reader_control *p = make_reader_control(pic);
   size_t ai;
   pic_value val;
   int c;
@@ -770,6 +835,376 @@ read_value(pic_state *pic, pic_value port)
   return pic_protect(pic, val);
 }
 
+static pic_value
+read_value(pic_state *pic, pic_value port)
+{
+  return read_with(pic, port, make_reader_control(pic));
+}
+
+/*
+ * Push reader. Bytes arrive in arbitrary chunks; a small state machine
+ * driven by the reader tables finds where each top-level datum ends,
+ * and only then is the datum read from the buffered bytes by read_value.
+ */
+
+enum {
+  PUSH_TOP,                     /* between tokens */
+  PUSH_ATOM,                    /* symbol, number, #t, #\a, ... */
+  PUSH_DIRECTIVE,               /* #!fold-case, or a #! line comment */
+  PUSH_STRING,
+  PUSH_PIPE,
+  PUSH_ESCAPE,                  /* after a backslash in a string or |symbol| */
+  PUSH_COMMENT,                 /* ; to the end of line */
+  PUSH_BLOCK_COMMENT,           /* #| ... |# */
+  PUSH_HASH,                    /* after # */
+  PUSH_CHAR,                    /* after #\ */
+  PUSH_LABEL,                   /* #digits */
+  PUSH_COMMA                    /* after , or #, */
+};
+
+struct push_reader {
+  char *buf;
+  int len, capa;
+  int pos;                      /* bytes scanned so far */
+  int state, ret;               /* ret: state to resume after an escape */
+  int tok;                      /* start of the current atom */
+  int depth;                    /* open parentheses */
+  int need;                     /* datums still missing at top level */
+  int nest, prev;               /* #| nesting and the last character seen in it */
+  int typecase;                 /* #!fold-case holds until #!no-fold-case */
+  int start;                    /* bytes read by the current feed */
+  pic_value list;               /* datums read by the current feed, reversed */
+};
+
+static void
+push_reader_dtor(pic_state *pic, void *data)
+{
+  struct push_reader *r = data;
+
+  pic_free(pic, r->buf);
+  pic_free(pic, r);
+}
+
+static void
+push_reader_mark(pic_state *pic, void *data, void (*mark)(pic_state *, pic_value))
+{
+  struct push_reader *r = data;
+
+  mark(pic, r->list);
+}
+
+static const pic_data_type push_reader_type = { "push-reader", push_reader_dtor, push_reader_mark };
+
+/* a datum ended; is it the last one the top-level datum was waiting for? */
+static bool
+push_element(struct push_reader *r)
+{
+  if (r->depth != 0 || --r->need != 0) {
+    return false;
+  }
+  r->need = 1;
+  return true;
+}
+
+/* returns the end of the next complete datum in r->buf, or -1 */
+static int
+push_scan(struct push_reader *r)
+{
+  pic_reader_t f;
+  int c;
+
+  while (r->pos < r->len) {
+    c = (unsigned char) r->buf[r->pos++];
+
+    switch (r->state) {
+    case PUSH_TOP:
+      if (isspace(c)) {
+        break;
+      }
+      f = reader_table(c);
+      if (f == read_pair) {
+        r->depth++;
+      } else if (f == read_unmatch) {
+        if (r->depth > 0) {
+          r->depth--;
+        }
+        if (push_element(r)) {
+          return r->pos;
+        }
+      } else if (f == read_string) {
+        r->state = PUSH_STRING;
+      } else if (f == read_pipe) {
+        r->state = PUSH_PIPE;
+      } else if (f == read_comment) {
+        r->state = PUSH_COMMENT;
+      } else if (f == read_unquote) {
+        r->state = PUSH_COMMA;
+      } else if (f == read_dispatch) {
+        r->tok = r->pos - 1;
+        r->state = PUSH_HASH;
+      } else if (f != read_quote && f != read_quasiquote) {
+        r->tok = r->pos - 1;
+        r->state = PUSH_ATOM;
+      }
+      break;
+
+    case PUSH_ATOM:
+      if (! isdelim(c)) {
+        break;
+      }
+      r->state = PUSH_TOP;
+      if (c == '(' && r->pos - 1 - r->tok == 3 && memcmp(r->buf + r->tok, "#u8", 3) == 0) {
+        r->depth++;
+        break;
+      }
+      r->pos--;                 /* the delimiter belongs to what follows */
+      if (push_element(r)) {
+        return r->pos;
+      }
+      break;
+
+    case PUSH_DIRECTIVE:
+      if (! isdelim(c)) {
+        break;
+      }
+      r->pos--;
+      if ((r->pos - r->tok == 11 && memcmp(r->buf + r->tok, "#!fold-case", 11) == 0) ||
+          (r->pos - r->tok == 14 && memcmp(r->buf + r->tok, "#!no-fold-case", 14) == 0)) {
+        r->state = PUSH_TOP;
+      } else {
+        r->state = PUSH_COMMENT;
+      }
+      break;
+
+    case PUSH_STRING:
+    case PUSH_PIPE:
+      if (c == '\\') {
+        r->ret = r->state;
+        r->state = PUSH_ESCAPE;
+      } else if (c == (r->state == PUSH_STRING ? '"' : '|')) {
+        r->state = PUSH_TOP;
+        if (push_element(r)) {
+          return r->pos;
+        }
+      }
+      break;
+
+    case PUSH_ESCAPE:
+      r->state = r->ret;
+      break;
+
+    case PUSH_COMMENT:
+      if (c == '\n') {
+        r->state = PUSH_TOP;
+      }
+      break;
+
+    case PUSH_BLOCK_COMMENT:
+      if (r->prev == '|' && c == '#') {
+        c = 0;
+        if (--r->nest == 0) {
+          r->state = PUSH_TOP;
+        }
+      } else if (r->prev == '#' && c == '|') {
+        c = 0;
+        r->nest++;
+      }
+      r->prev = c;
+      break;
+
+    case PUSH_HASH:
+      f = reader_dispatch(c);
+      r->state = PUSH_TOP;
+      if (f == read_block_comment) {
+        r->nest = 1;
+        r->prev = 0;
+        r->state = PUSH_BLOCK_COMMENT;
+      } else if (f == read_datum_comment) {
+        if (r->depth == 0) {    /* inside a list, the list ends the datum */
+          r->need++;
+        }
+      } else if (f == read_syntax_unquote) {
+        r->state = PUSH_COMMA;
+      } else if (f == read_vector) {
+        r->depth++;
+      } else if (f == read_char) {
+        r->state = PUSH_CHAR;
+      } else if (f == read_label) {
+        r->state = PUSH_LABEL;
+      } else if (f == read_directive) {
+        r->state = PUSH_DIRECTIVE;
+      } else if (f != read_syntax_quote && f != read_syntax_quasiquote) {
+        r->pos--;               /* #t, #x1F, #u8(...: c is part of the atom */
+        r->state = PUSH_ATOM;
+      }
+      break;
+
+    case PUSH_CHAR:
+      r->state = PUSH_ATOM;     /* the character itself may be a delimiter */
+      break;
+
+    case PUSH_LABEL:
+      if (isdigit(c)) {
+        break;
+      }
+      r->state = PUSH_TOP;
+      if (c == '#') {           /* #n# refers to a datum; #n= prefixes one */
+        if (push_element(r)) {
+          return r->pos;
+        }
+      } else if (c != '=') {
+        r->pos--;
+        r->state = PUSH_ATOM;
+      }
+      break;
+
+    case PUSH_COMMA:
+      if (c != '@') {
+        r->pos--;
+      }
+      r->state = PUSH_TOP;
+      break;
+    }
+  }
+  return -1;
+}
+
+pic_value
+pic_make_push_reader(pic_state *pic)
+{
+  struct push_reader *r;
+
+  r = pic_malloc(pic, sizeof *r);
+  r->capa = 256;
+  r->buf = pic_malloc(pic, r->capa);
+  r->len = r->pos = r->tok = 0;
+  r->state = r->ret = PUSH_TOP;
+  r->depth = 0;
+  r->need = 1;
+  r->nest = r->prev = 0;
+  r->typecase = CASE_DEFAULT;
+  r->start = 0;
+  r->list = pic_nil_value(pic);
+
+  return pic_data_value(pic, r, &push_reader_type);
+}
+
+/* drop the first n bytes, which have been read */
+static void
+push_consume(struct push_reader *r, int n)
+{
+  memmove(r->buf, r->buf + n, r->len - n);
+  r->len -= n;
+  r->pos -= n;
+  r->tok -= n;
+}
+
+/*
+ * Reads the datums push_scan finds. The progress is kept in r rather than
+ * in locals, so that the feed can pick it up after one of them raises.
+ */
+static void
+push_read(pic_state *pic, struct push_reader *r)
+{
+  struct reader_control *p;
+  pic_value port, val;
+  size_t ai = pic_enter(pic);
+  int end;
+
+  while ((end = push_scan(r)) >= 0) {
+    p = make_reader_control(pic);
+    p->typecase = r->typecase;
+    port = pic_fmemopen(pic, r->buf + r->start, end - r->start, "r");
+    val = read_with(pic, port, p);
+    pic_fclose(pic, port);
+    r->typecase = p->typecase;
+    r->start = end;
+    r->list = pic_cons(pic, val, r->list);
+    pic_leave(pic, ai);
+  }
+}
+
+pic_value
+pic_push_reader_feed(pic_state *pic, pic_value reader, const char *buf, int len)
+{
+  struct push_reader *r = pic_data(pic, reader);
+  pic_value e, list;
+  size_t ai;
+
+  if (r->len + len > r->capa) {
+    while (r->len + len > r->capa) {
+      r->capa *= 2;
+    }
+    r->buf = pic_realloc(pic, r->buf, r->capa);
+  }
+  memcpy(r->buf + r->len, buf, len);
+  r->len += len;
+
+  ai = pic_enter(pic);
+  r->start = 0;
+  r->list = pic_nil_value(pic);
+  pic_try {
+    push_read(pic, r);
+  }
+  pic_catch(e) {
+    if (pic_nil_p(pic, r->list)) {
+      /* drop the bad datum, which ends where the scan stopped, so that
+         feeding can go on after the error */
+      push_consume(r, r->pos);
+      pic_raise(pic, e);
+    }
+    /* hand out what was read; the next feed scans the bad datum again */
+    r->pos = r->start;
+  }
+  push_consume(r, r->start);    /* once per feed, not per datum */
+
+  list = pic_reverse(pic, r->list);
+  r->list = pic_nil_value(pic);
+  pic_leave(pic, ai);
+  return pic_protect(pic, list);
+}
+
+static pic_value
+pic_read_make_push_reader(pic_state *pic)
+{
+  pic_get_args(pic, "");
+
+  return pic_make_push_reader(pic);
+}
+
+static pic_value
+pic_read_push_reader_p(pic_state *pic)
+{
+  pic_value obj;
+
+  pic_get_args(pic, "o", &obj);
+
+  return pic_bool_value(pic, pic_data_p(pic, obj, &push_reader_type));
+}
+
+static pic_value
+pic_read_push_reader_feed(pic_state *pic)
+{
+  pic_value reader, chunk;
+  const char *buf;
+  int len;
+
+  pic_get_args(pic, "oo", &reader, &chunk);
+
+  if (! pic_data_p(pic, reader, &push_reader_type)) {
+    pic_error(pic, "push reader required", 1, reader);
+  }
+  if (pic_blob_p(pic, chunk)) {
+    buf = (const char *) pic_blob(pic, chunk, &len);
+  } else if (pic_str_p(pic, chunk)) {
+    buf = pic_str(pic, chunk, &len);
+  } else {
+    pic_error(pic, "bytevector or string required", 1, chunk);
+  }
+
+  return pic_push_reader_feed(pic, reader, buf, len);
+}
+
 static pic_value
 pic_read_read(pic_state *pic)
 {
@@ -783,9 +1218,10 @@ pic_read_read(pic_state *pic)
 void
 pic_init_read(pic_state *pic)
 {
-  reader_table_init();
-
   pic_defun(pic, "read", pic_read_read);
+  pic_defun(pic, "make-push-reader", pic_read_make_push_reader);
+  pic_defun(pic, "push-reader?", pic_read_push_reader_p);
+  pic_defun(pic, "push-reader-feed!", pic_read_push_reader_feed);
 }
 
 #endif
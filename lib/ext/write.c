@@ -47,6 +47,7 @@ traverse(pic_state *pic, pic_value obj, struct writer_control *p)
   case PIC_TYPE_PAIR:
   case PIC_TYPE_VECTOR:
   case PIC_TYPE_DICT:
+  case PIC_TYPE_TABLE:
   case PIC_TYPE_RECORD: {
 
     if (! pic_attr_has(pic, shared, obj)) {
@@ -70,9 +71,20 @@ traverse(pic_state *pic, pic_value obj, struct writer_control *p)
         while (pic_dict_next(pic, obj, &it, NULL, &val)) {
           traverse(pic, val, p);
         }
+      } else if (pic_table_p(pic, obj)) {
+        /* hash table */
+        int it = 0;
+        pic_value key, val;
+        while (pic_table_next(pic, obj, &it, &key, &val)) {
+          traverse(pic, key, p);
+          traverse(pic, val, p);
+        }
       } else {
         /* record */
-        traverse(pic, pic_record_datum(pic, obj), p);
+        int i, len = pic_record_len(pic, obj);
+        for (i = 0; i < len; ++i) {
+          traverse(pic, pic_record_ref(pic, obj, i), p);
+        }
       }
 
       if (p->op == OP_WRITE) {
@@ -297,13 +309,42 @@ write_dict(pic_state *pic, pic_value dict, pic_value port, struct writer_control
   pic_fprintf(pic, port, ")");
 }
 
+static void
+write_table(pic_state *pic, pic_value table, pic_value port, struct writer_control *p)
+{
+  static const char *equiv[] = { "eq?", "eqv?", "equal?", "string=?" };
+  struct table *t = table_ptr(pic, table);
+  pic_value key, val;
+  int it = 0;
+
+  /* not readable: an eq? table read back would not find its keys anyway */
+  pic_fprintf(pic, port, "#<hash-table ");
+  if (t->kind <= PIC_TABLE_STRING) {
+    pic_fputs(pic, equiv[t->kind], port);
+  } else {
+    write_core(pic, t->equal, port, p);
+  }
+  while (pic_table_next(pic, table, &it, &key, &val)) {
+    pic_fputs(pic, " (", port);
+    write_core(pic, key, port, p);
+    pic_fputs(pic, " . ", port);
+    write_core(pic, val, port, p);
+    pic_fputc(pic, ')', port);
+  }
+  pic_fprintf(pic, port, ">");
+}
+
 static void
 write_record(pic_state *pic, pic_value obj, pic_value port, struct writer_control *p)
 {
+  int i, len = pic_record_len(pic, obj);
+
   pic_fprintf(pic, port, "#<");
-  write_core(pic, pic_record_type(pic, obj), port, p);
-  pic_fprintf(pic, port, " ");
-  write_core(pic, pic_record_datum(pic, obj), port, p);
+  write_core(pic, obj_value(pic, rec_ptr(pic, obj)->type->name), port, p);
+  for (i = 0; i < len; ++i) {
+    pic_fprintf(pic, port, " ");
+    write_core(pic, pic_record_ref(pic, obj, i), port, p);
+  }
   pic_fprintf(pic, port, ">");
 }
 
@@ -349,10 +390,14 @@ typename(pic_state *pic, pic_value obj)
     return "data";
   case PIC_TYPE_DICT:
     return "dictionary";
+  case PIC_TYPE_TABLE:
+    return "hash-table";
   case PIC_TYPE_ATTR:
     return "attribute";
   case PIC_TYPE_RECORD:
     return "record";
+  case PIC_TYPE_RECORD_TYPE:
+    return "record-type";
   default:
     pic_error(pic, "typename: invalid type given", 1, obj);
   }
@@ -418,6 +463,9 @@ write_core(pic_state *pic, pic_value obj, pic_value port, struct writer_control
   case PIC_TYPE_DICT:
     write_dict(pic, obj, port, p);
     break;
+  case PIC_TYPE_TABLE:
+    write_table(pic, obj, port, p);
+    break;
   case PIC_TYPE_RECORD:
     write_record(pic, obj, port, p);
     break;
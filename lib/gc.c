@@ -7,6 +7,13 @@
 #include "object.h"
 #include "state.h"
 
+struct checkpoint {             /* see pic_checkpoint */
+  struct object *first;         /* newest object at the checkpoint */
+  pic_value dyn_env;
+  char *buf;
+  size_t len, capa;
+};
+
 #if PIC_USE_LIBC
 void *
 pic_default_allocf(void *PIC_UNUSED(userdata), void *ptr, size_t size)
@@ -82,7 +89,7 @@ pic_protect(pic_state *pic, pic_value v)
 void *
 pic_alloca(pic_state *pic, size_t n)
 {
-  static const pic_data_type t = { "pic_alloca", pic_free };
+  static const pic_data_type t = { "pic_alloca", pic_free, NULL };
 
   return pic_data(pic, pic_data_value(pic, pic_malloc(pic, n), &t));
 }
@@ -94,6 +101,7 @@ pic_alloca(pic_state *pic, size_t n)
 #define unmark(obj) ((obj)->tt &= ~GC_MARK)
 
 static void gc_mark_object(pic_state *, struct object *);
+static size_t type2size(int);
 
 static void
 gc_mark(pic_state *pic, pic_value v)
@@ -104,6 +112,43 @@ gc_mark(pic_state *pic, pic_value v)
   gc_mark_object(pic, pic_ptr(pic, v));
 }
 
+/*
+ * The registers of a frame hold the rest of its continuation, a chain as
+ * long as the program recursed deep, so frames are marked off a stack
+ * of their own rather than on the C stack.
+ */
+static void
+gc_mark_frame(pic_state *pic, struct frame *frame)
+{
+  bool draining = pic->gc_frames_len > 0;
+  size_t n;
+  int i;
+
+  if (pic->gc_frames_len == pic->gc_frames_size) {
+    pic->gc_frames_size = pic->gc_frames_size * 2 + 16;
+    pic->gc_frames = pic_realloc(pic, pic->gc_frames, sizeof(struct frame *) * pic->gc_frames_size);
+  }
+  pic->gc_frames[pic->gc_frames_len++] = frame;
+
+  if (draining) {
+    return;
+  }
+  while (pic->gc_frames_len > 0) {
+    /* the frame stays on the stack while its registers push more */
+    n = pic->gc_frames_len - 1;
+    frame = pic->gc_frames[n];
+    for (i = 0; i < frame->regc; ++i) {
+      gc_mark(pic, frame->regs[i]);
+    }
+    if (frame->up && ! is_alive((struct object *) frame->up)) {
+      mark((struct object *) frame->up);
+      pic->gc_frames[n] = frame->up;
+    } else {
+      pic->gc_frames[n] = pic->gc_frames[--pic->gc_frames_len];
+    }
+  }
+}
+
 static void
 gc_mark_object(pic_state *pic, struct object *obj)
 {
@@ -126,14 +171,7 @@ gc_mark_object(pic_state *pic, struct object *obj)
     break;
   }
   case PIC_TYPE_FRAME: {
-    struct frame *frame = (struct frame *) obj;
-    int i;
-    for (i = 0; i < frame->regc; ++i) {
-      gc_mark(pic, frame->regs[i]);
-    }
-    if (frame->up) {
-      LOOP(frame->up);
-    }
+    gc_mark_frame(pic, (struct frame *) obj);
     break;
   }
   case PIC_TYPE_PROC_FUNC: {
@@ -182,12 +220,40 @@ gc_mark_object(pic_state *pic, struct object *obj)
     }
     break;
   }
+  case PIC_TYPE_TABLE: {
+    struct table *t = (struct table *) obj;
+    int i;
+    for (i = 0; i < t->capa; ++i) {
+      if (t->b[i].hash > 1) {
+        gc_mark(pic, t->b[i].key);
+        gc_mark(pic, t->b[i].val);
+      }
+    }
+    for (i = t->migrated; i < t->old_capa; ++i) {
+      if (t->old[i].hash > 1) {
+        gc_mark(pic, t->old[i].key);
+        gc_mark(pic, t->old[i].val);
+      }
+    }
+    gc_mark(pic, t->equal);
+    gc_mark(pic, t->hash);
+    break;
+  }
   case PIC_TYPE_RECORD: {
     struct record *rec = (struct record *) obj;
-    gc_mark(pic, rec->datum);
+    int i;
+    for (i = 0; i < rec->type->nfields; ++i) {
+      gc_mark(pic, rec->slots[i]);
+    }
     LOOP(rec->type);
     break;
   }
+  case PIC_TYPE_RECORD_TYPE: {
+    struct record_type *type = (struct record_type *) obj;
+    gc_mark(pic, type->fields);
+    LOOP(type->name);
+    break;
+  }
   case PIC_TYPE_SYMBOL: {
     struct symbol *sym = (struct symbol *) obj;
     LOOP(sym->str);
@@ -211,9 +277,23 @@ gc_mark_object(pic_state *pic, struct object *obj)
     break;
   }
 
+  case PIC_TYPE_ROPE_SLICE: {
+    struct rope_slice *slice = (struct rope_slice *) obj;
+    slice->prev = pic->gc_slices;
+    pic->gc_slices = slice;
+    break;
+  }
+
+  case PIC_TYPE_DATA: {
+    struct data *data = (struct data *) obj;
+    if (data->type->mark) {
+      (data->type->mark)(pic, data->data, gc_mark);
+    }
+    break;
+  }
+
   case PIC_TYPE_ROPE_LEAF:
   case PIC_TYPE_BLOB:
-  case PIC_TYPE_DATA:
     break;
 
   default:
@@ -247,6 +327,12 @@ gc_finalize_object(pic_state *pic, struct object *obj)
     kh_destroy(dict, &dict->hash);
     break;
   }
+  case PIC_TYPE_TABLE: {
+    struct table *t = (struct table *) obj;
+    pic_free(pic, t->b);
+    pic_free(pic, t->old);
+    break;
+  }
   case PIC_TYPE_SYMBOL: {
     /* TODO: remove this symbol's entry from pic->syms immediately */
     break;
@@ -278,8 +364,10 @@ gc_finalize_object(pic_state *pic, struct object *obj)
 
   case PIC_TYPE_STRING:
   case PIC_TYPE_ROPE_NODE:
+  case PIC_TYPE_ROPE_SLICE:
   case PIC_TYPE_PAIR:
   case PIC_TYPE_RECORD:
+  case PIC_TYPE_RECORD_TYPE:
   case PIC_TYPE_PROC_FUNC:
   case PIC_TYPE_PROC_IREP:
     break;
@@ -298,8 +386,10 @@ pic_gc(pic_state *pic)
   struct symbol *sym;
   int it;
   struct object *obj, *prev, *next;
+  struct rope_slice *slice;
 
   assert(pic->gc_attrs == NULL);
+  assert(pic->gc_slices == NULL);
 
   if (! pic->gc_enable) {
     return;
@@ -311,7 +401,6 @@ pic_gc(pic_state *pic)
     if (cxt->fp) gc_mark_object(pic, (struct object *)cxt->fp);
     if (cxt->sp) gc_mark_object(pic, (struct object *)cxt->sp);
     if (cxt->irep) gc_mark_object(pic, (struct object *)cxt->irep);
-    gc_mark(pic, cxt->conts);
   }
 
   for (j = 0; j < pic->ai; ++j) {
@@ -319,8 +408,19 @@ pic_gc(pic_state *pic)
   }
 
   gc_mark(pic, pic->globals);
+  gc_mark(pic, pic->funcs);
+  gc_mark(pic, pic->rectypes);
+  gc_mark(pic, pic->dyn_env);
   gc_mark(pic, pic->halt);
 
+  /* everything a checkpoint can go back to is alive */
+  if (pic->checkpoint) {
+    for (obj = pic->checkpoint->first; obj != &pic->gc_head; obj = obj->next) {
+      gc_mark_object(pic, obj);
+    }
+    gc_mark(pic, pic->checkpoint->dyn_env);
+  }
+
   /* scan weak references */
 
   do {
@@ -351,6 +451,28 @@ pic_gc(pic_state *pic)
     }
   } while (j > 0);
 
+  /* keep buffers shared by substrings alive */
+
+  for (slice = pic->gc_slices; slice != NULL; slice = slice->prev) {
+    if (slice->len * PIC_SLICE_RATIO >= slice->base->len) {
+      mark(slice->base);
+    }
+  }
+
+  /* compact small substrings that alone hold on to a large buffer */
+
+  while (pic->gc_slices != NULL) {
+    slice = pic->gc_slices;
+    if (! is_alive(slice->base)) {
+      char *buf = pic_malloc(pic, slice->len + 1);
+      memcpy(buf, slice->str, slice->len);
+      buf[slice->len] = '\0';
+      slice->str = buf;
+      slice->tt = PIC_TYPE_ROPE_LEAF | GC_MARK;
+    }
+    pic->gc_slices = slice->prev;
+  }
+
   /* reclaim dead weak references */
 
   while (pic->gc_attrs != NULL) {
@@ -377,10 +499,12 @@ pic_gc(pic_state *pic)
 
   /* reclaim dead objects */
 
+  pic->gc_live = 0;
   for (prev = &pic->gc_head, obj = prev->next; obj != &pic->gc_head; prev = obj, obj = next) {
     next = obj->next;
     if (is_alive(obj)) {
       unmark(obj);
+      pic->gc_live += type2size(obj_type(obj));
     } else {
       gc_finalize_object(pic, obj);
       pic_free(pic, obj);
@@ -390,6 +514,237 @@ pic_gc(pic_state *pic)
   }
 }
 
+/*
+ * checkpoint
+ *
+ * Objects are only ever added at the head of the heap list, so the
+ * objects older than the head at the time of a checkpoint stay in the
+ * same order behind it. pic_checkpoint writes down the contents of each
+ * of them that can change (pair and vector slots, string ropes, closure
+ * frames, hash tables, ...) and pic_reset writes them back in the same
+ * order. Objects made in between become unreachable again and are left
+ * to the GC.
+ * Foreign data is not restored.
+ */
+
+static void
+save(pic_state *pic, struct checkpoint *c, const void *p, size_t n)
+{
+  if (c->len + n > c->capa) {
+    while (c->len + n > c->capa) {
+      c->capa = c->capa * 2 + 1024;
+    }
+    c->buf = pic_realloc(pic, c->buf, c->capa);
+  }
+  memcpy(c->buf + c->len, p, n);
+  c->len += n;
+}
+
+static void
+restore(struct checkpoint *c, size_t *pos, void *p, size_t n)
+{
+  memcpy(p, c->buf + *pos, n);
+  *pos += n;
+}
+
+#define SAVE_HASH(name, h) do {                                         \
+    save(pic, c, (h), sizeof *(h));                                     \
+    if ((h)->n_buckets != 0) {                                          \
+      save(pic, c, (h)->ctrl, (h)->n_buckets + AC_GROUP);               \
+      save(pic, c, (h)->slots, (h)->n_buckets * sizeof(kh_##name##_slot_t)); \
+    }                                                                   \
+  } while (0)
+
+#define RESTORE_HASH(name, h) do {                                      \
+    khash_t(name) tmp;                                                  \
+    restore(c, pos, &tmp, sizeof tmp);                                  \
+    if (tmp.n_buckets != (h)->n_buckets) {                              \
+      kh_destroy(name, (h));                                            \
+      tmp.ctrl = tmp.n_buckets ? pic_malloc(pic, tmp.n_buckets + AC_GROUP) : NULL; \
+      tmp.slots = tmp.n_buckets ? pic_malloc(pic, tmp.n_buckets * sizeof(kh_##name##_slot_t)) : NULL; \
+    } else {                                                            \
+      tmp.ctrl = (h)->ctrl;                                             \
+      tmp.slots = (h)->slots;                                           \
+    }                                                                   \
+    *(h) = tmp;                                                         \
+    if ((h)->n_buckets != 0) {                                          \
+      restore(c, pos, (h)->ctrl, (h)->n_buckets + AC_GROUP);            \
+      restore(c, pos, (h)->slots, (h)->n_buckets * sizeof(kh_##name##_slot_t)); \
+    }                                                                   \
+  } while (0)
+
+static void
+save_object(pic_state *pic, struct checkpoint *c, struct object *obj)
+{
+  switch (obj_type(obj)) {
+  case PIC_TYPE_PAIR: {
+    struct pair *pair = (struct pair *) obj;
+    save(pic, c, &pair->car, sizeof(pic_value));
+    save(pic, c, &pair->cdr, sizeof(pic_value));
+    break;
+  }
+  case PIC_TYPE_VECTOR: {
+    struct vector *vec = (struct vector *) obj;
+    save(pic, c, vec->data, sizeof(pic_value) * vec->len);
+    break;
+  }
+  case PIC_TYPE_STRING: {
+    struct string *str = (struct string *) obj;
+    save(pic, c, &str->rope, sizeof(struct rope *));
+    break;
+  }
+  case PIC_TYPE_BLOB: {
+    struct blob *blob = (struct blob *) obj;
+    save(pic, c, &blob->len, sizeof(int));
+    save(pic, c, blob->data, blob->len);
+    break;
+  }
+  case PIC_TYPE_FRAME: {
+    struct frame *frame = (struct frame *) obj;
+    save(pic, c, frame->regs, sizeof(pic_value) * frame->regc);
+    break;
+  }
+  case PIC_TYPE_RECORD: {
+    struct record *rec = (struct record *) obj;
+    save(pic, c, rec->slots, sizeof(pic_value) * rec->type->nfields);
+    break;
+  }
+  case PIC_TYPE_DICT:
+    SAVE_HASH(dict, &((struct dict *) obj)->hash);
+    break;
+  case PIC_TYPE_ATTR:
+    SAVE_HASH(attr, &((struct attr *) obj)->hash);
+    break;
+  case PIC_TYPE_TABLE: {
+    struct table *t = (struct table *) obj;
+    save(pic, c, t, sizeof *t);
+    save(pic, c, t->b, sizeof(struct bucket) * t->capa);
+    save(pic, c, t->old, sizeof(struct bucket) * t->old_capa);
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+static void
+restore_object(pic_state *pic, struct checkpoint *c, struct object *obj, size_t *pos)
+{
+  switch (obj_type(obj)) {
+  case PIC_TYPE_PAIR: {
+    struct pair *pair = (struct pair *) obj;
+    restore(c, pos, &pair->car, sizeof(pic_value));
+    restore(c, pos, &pair->cdr, sizeof(pic_value));
+    break;
+  }
+  case PIC_TYPE_VECTOR: {
+    struct vector *vec = (struct vector *) obj;
+    restore(c, pos, vec->data, sizeof(pic_value) * vec->len);
+    break;
+  }
+  case PIC_TYPE_STRING: {
+    struct string *str = (struct string *) obj;
+    restore(c, pos, &str->rope, sizeof(struct rope *));
+    break;
+  }
+  case PIC_TYPE_BLOB: {
+    struct blob *blob = (struct blob *) obj;
+    int len;
+    restore(c, pos, &len, sizeof(int));
+    if (len != blob->len) {
+      blob->data = pic_realloc(pic, blob->data, len);
+      blob->len = len;
+    }
+    restore(c, pos, blob->data, len);
+    break;
+  }
+  case PIC_TYPE_FRAME: {
+    struct frame *frame = (struct frame *) obj;
+    restore(c, pos, frame->regs, sizeof(pic_value) * frame->regc);
+    break;
+  }
+  case PIC_TYPE_RECORD: {
+    struct record *rec = (struct record *) obj;
+    restore(c, pos, rec->slots, sizeof(pic_value) * rec->type->nfields);
+    break;
+  }
+  case PIC_TYPE_DICT:
+    RESTORE_HASH(dict, &((struct dict *) obj)->hash);
+    break;
+  case PIC_TYPE_ATTR:
+    RESTORE_HASH(attr, &((struct attr *) obj)->hash);
+    break;
+  case PIC_TYPE_TABLE: {
+    struct table *t = (struct table *) obj, tmp;
+    restore(c, pos, &tmp, sizeof tmp);
+    pic_free(pic, t->b);
+    pic_free(pic, t->old);
+    t->kind = tmp.kind;
+    t->equal = tmp.equal;
+    t->hash = tmp.hash;
+    t->capa = tmp.capa;
+    t->used = tmp.used;
+    t->size = tmp.size;
+    t->old_capa = tmp.old_capa;
+    t->migrated = tmp.migrated;
+    t->b = t->capa ? pic_malloc(pic, sizeof(struct bucket) * t->capa) : NULL;
+    t->old = t->old_capa ? pic_malloc(pic, sizeof(struct bucket) * t->old_capa) : NULL;
+    restore(c, pos, t->b, sizeof(struct bucket) * t->capa);
+    restore(c, pos, t->old, sizeof(struct bucket) * t->old_capa);
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+void
+pic_checkpoint(pic_state *pic)
+{
+  struct checkpoint *c;
+  struct object *obj;
+
+  pic_drop_checkpoint(pic);
+  pic_gc(pic);
+
+  c = pic_malloc(pic, sizeof(struct checkpoint));
+  c->first = pic->gc_head.next;
+  c->dyn_env = pic->dyn_env;
+  c->buf = NULL;
+  c->len = c->capa = 0;
+  for (obj = c->first; obj != &pic->gc_head; obj = obj->next) {
+    save_object(pic, c, obj);
+  }
+  pic->checkpoint = c;
+}
+
+void
+pic_reset(pic_state *pic)
+{
+  struct checkpoint *c = pic->checkpoint;
+  struct object *obj;
+  size_t pos = 0;
+
+  if (c == NULL) {
+    pic_error(pic, "pic_reset: no checkpoint", 0);
+  }
+  for (obj = c->first; obj != &pic->gc_head; obj = obj->next) {
+    restore_object(pic, c, obj, &pos);
+  }
+  assert(pos == c->len);
+  pic->dyn_env = c->dyn_env;
+}
+
+void
+pic_drop_checkpoint(pic_state *pic)
+{
+  if (pic->checkpoint) {
+    pic_free(pic, pic->checkpoint->buf);
+    pic_free(pic, pic->checkpoint);
+    pic->checkpoint = NULL;
+  }
+}
+
 static size_t
 type2size(int type)
 {
@@ -399,29 +754,33 @@ type2size(int type)
     case PIC_TYPE_STRING: return sizeof(struct string);
     case PIC_TYPE_DATA: return sizeof(struct data);
     case PIC_TYPE_DICT: return sizeof(struct dict);
+    case PIC_TYPE_TABLE: return sizeof(struct table);
     case PIC_TYPE_SYMBOL: return sizeof(struct symbol);
     case PIC_TYPE_ATTR: return sizeof(struct attr);
     case PIC_TYPE_IREP: return sizeof(struct irep);
     case PIC_TYPE_PAIR: return sizeof(struct pair);
     case PIC_TYPE_FRAME: return sizeof(struct frame);
     case PIC_TYPE_RECORD: return sizeof(struct record);
+    case PIC_TYPE_RECORD_TYPE: return sizeof(struct record_type);
     case PIC_TYPE_PROC_FUNC: return sizeof(struct proc);
     case PIC_TYPE_PROC_IREP: return sizeof(struct proc);
     case PIC_TYPE_ROPE_LEAF: return sizeof(struct rope_leaf);
     case PIC_TYPE_ROPE_NODE: return sizeof(struct rope_node);
+    case PIC_TYPE_ROPE_SLICE: return sizeof(struct rope_slice);
     default: PIC_UNREACHABLE();
   }
 }
 
-struct object *
-pic_obj_alloc_unsafe(pic_state *pic, int type)
+static struct object *
+obj_alloc(pic_state *pic, size_t size, int type)
 {
   struct object *obj;
-  size_t size = type2size(type);
 
-  if (pic->gc_count > PIC_GC_PERIOD) {
+  /* a collection takes time in proportion to what survives it, so wait
+     for at least as much to be allocated again */
+  if (pic->gc_count > PIC_GC_PERIOD && pic->gc_count > pic->gc_live) {
     pic_gc(pic);
-    pic->gc_count -= PIC_GC_PERIOD;
+    pic->gc_count = 0;
   }
 
   obj = pic_malloc(pic, size);
@@ -434,6 +793,12 @@ pic_obj_alloc_unsafe(pic_state *pic, int type)
   return obj;
 }
 
+struct object *
+pic_obj_alloc_unsafe(pic_state *pic, int type)
+{
+  return obj_alloc(pic, type2size(type), type);
+}
+
 struct object *
 pic_obj_alloc(pic_state *pic, int type)
 {
@@ -444,3 +809,14 @@ pic_obj_alloc(pic_state *pic, int type)
   pic_protect(pic, obj_value(pic, obj));
   return obj;
 }
+
+struct object *
+pic_obj_alloc_sized(pic_state *pic, size_t size, int type)
+{
+  struct object *obj;
+
+  obj = obj_alloc(pic, size, type);
+
+  pic_protect(pic, obj_value(pic, obj));
+  return obj;
+}
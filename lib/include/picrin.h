@@ -59,6 +59,11 @@ typedef void *(*pic_allocf)(void *userdata, void *ptr, size_t n);
 typedef void (*pic_panicf)(pic_state *, const char *msg, int n, pic_value *args);
 pic_state *pic_open(pic_allocf allocf, void *userdata, pic_panicf panicf);
 void pic_close(pic_state *);
+pic_value pic_save_image(pic_state *);
+pic_value pic_read_image(pic_state *, pic_value image);
+void pic_load_image(pic_state *, pic_value roots); /* from pic_read_image */
+void pic_checkpoint(pic_state *);
+void pic_reset(pic_state *);
 
 
 /*
@@ -93,6 +98,7 @@ bool pic_equal_p(pic_state *, pic_value, pic_value);
 typedef struct {
   const char *type_name;
   void (*dtor)(pic_state *, void *);
+  void (*mark)(pic_state *, void *, void (*)(pic_state *, pic_value));
 } pic_data_type;
 
 bool pic_int_p(pic_state *, pic_value);
@@ -124,8 +130,11 @@ void *pic_data(pic_state *, pic_value data);
 bool pic_blob_p(pic_state *, pic_value);
 pic_value pic_blob_value(pic_state *, const unsigned char *buf, int len);
 unsigned char *pic_blob(pic_state *, pic_value blob, int *len);
+unsigned char *pic_blob_take(pic_state *, pic_value blob, int *len); /* leaves blob empty */
+pic_value pic_blob_adopt(pic_state *, unsigned char *buf, int len); /* buf from pic_malloc */
 pic_value pic_serialize(pic_state *pic, pic_value obj);
 pic_value pic_deserialize(pic_state *pic, pic_value blob);
+pic_value pic_deserialize_static(pic_state *pic, const unsigned char *buf, int len, pic_value resolve); /* buf must outlive pic */
 
 
 /*
@@ -144,6 +153,18 @@ int pic_str_len(pic_state *, pic_value str);
 pic_value pic_str_cat(pic_state *, pic_value str1, pic_value str2);
 pic_value pic_str_sub(pic_state *, pic_value str, int i, int j);
 
+typedef struct {
+  pic_value str, chunk;
+  char *buf;
+  int len, capa;
+} pic_strbuf;
+
+void pic_strbuf_init(pic_state *, pic_strbuf *);
+void pic_strbuf_write(pic_state *, pic_strbuf *, const char *str, int len);
+void pic_strbuf_putc(pic_state *, pic_strbuf *, char c);
+pic_value pic_strbuf_value(pic_state *, pic_strbuf *);
+pic_value pic_strbuf_snapshot(pic_state *, pic_strbuf *);
+
 
 /*
  * symbol
@@ -151,7 +172,7 @@ pic_value pic_str_sub(pic_state *, pic_value str, int i, int j);
 
 bool pic_sym_p(pic_state *, pic_value);
 pic_value pic_intern(pic_state *, pic_value str);
-#define pic_intern_str(pic,s,i) pic_intern(pic, pic_str_value(pic, (s), (i)))
+pic_value pic_intern_str(pic_state *, const char *str, int len);
 #define pic_intern_cstr(pic,s) pic_intern(pic, pic_cstr_value(pic, (s)))
 #define pic_intern_lit(pic,lit) pic_intern(pic, pic_lit_value(pic, lit))
 pic_value pic_sym_name(pic_state *, pic_value sym);
@@ -216,6 +237,27 @@ int pic_dict_size(pic_state *, pic_value dict);
 bool pic_dict_next(pic_state *, pic_value dict, int *iter, pic_value *key, pic_value *val);
 
 
+/*
+ * hash table
+ */
+
+enum {
+  PIC_TABLE_EQ,
+  PIC_TABLE_EQV,
+  PIC_TABLE_EQUAL,
+  PIC_TABLE_STRING
+};
+
+bool pic_table_p(pic_state *, pic_value);
+pic_value pic_make_table(pic_state *, int kind);
+pic_value pic_table_ref(pic_state *, pic_value table, pic_value key);
+void pic_table_set(pic_state *, pic_value table, pic_value key, pic_value);
+void pic_table_del(pic_state *, pic_value table, pic_value key);
+bool pic_table_has(pic_state *, pic_value table, pic_value key);
+int pic_table_size(pic_state *, pic_value table);
+bool pic_table_next(pic_state *, pic_value table, int *iter, pic_value *key, pic_value *val);
+
+
 /*
  * attribute
  */
@@ -244,6 +286,10 @@ pic_value pic_vcall(pic_state *, pic_value proc, int, va_list);
 pic_value pic_vcallk(pic_state *, pic_value proc, int, va_list);
 pic_value pic_apply(pic_state *, pic_value proc, int n, pic_value *argv);
 pic_value pic_applyk(pic_state *, pic_value proc, int n, pic_value *argv);
+bool pic_run(pic_state *, pic_value task, long fuel, pic_value *result);
+pic_value pic_currentk(pic_state *);
+bool pic_resumable_p(pic_state *, pic_value k);
+pic_value pic_resumek(pic_state *, pic_value k, int n, pic_value *argv);
 
 
 /*
@@ -256,6 +302,7 @@ pic_value pic_ref(pic_state *, const char *name);
 void pic_set(pic_state *, const char *name, pic_value v);
 pic_value pic_make_var(pic_state *, pic_value init, pic_value conv);
 void pic_defun(pic_state *, const char *name, pic_func_t f);
+void pic_register_func(pic_state *, const char *name, pic_func_t f);
 void pic_defvar(pic_state *, const char *name, pic_value v);
 pic_value pic_funcall(pic_state *, const char *name, int n, ...);
 pic_value pic_values(pic_state *, int n, ...);
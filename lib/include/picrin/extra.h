@@ -42,6 +42,7 @@ pic_value pic_eof_object(pic_state *);
 bool pic_port_p(pic_state *, pic_value, const pic_port_type *type);
 /* basic methods */
 pic_value pic_funopen(pic_state *, void *cookie, const pic_port_type *type);
+pic_value pic_fmemopen(pic_state *, const char *buf, int len, const char *mode); /* copies buf */
 size_t pic_fread(pic_state *, void *ptr, size_t size, size_t count, pic_value port);
 size_t pic_fwrite(pic_state *, const void *ptr, size_t size, size_t count, pic_value port);
 long pic_fseek(pic_state *, pic_value port, long offset, int whence);
@@ -56,6 +57,8 @@ int pic_fgetc(pic_state *, pic_value port);
 int pic_fputs(pic_state *, const char *s, pic_value port);
 char *pic_fgets(pic_state *, char *s, int size, pic_value port);
 int pic_ungetc(pic_state *, int c, pic_value port);
+const char *pic_fpeekbuf(pic_state *, pic_value port, int *len); /* unread bytes already buffered */
+void pic_fskipbuf(pic_state *, pic_value port, int n);            /* consume n of them */
 int pic_fflush(pic_state *, pic_value port);
 int pic_setvbuf(pic_state *, pic_value port, char *buf, int mode, size_t size);
 /* formatted output */
@@ -64,11 +67,19 @@ int pic_fprintf(pic_state *, pic_value port, const char *fmt, ...);
 int pic_vfprintf(pic_state *, pic_value port, const char *fmt, va_list ap);
 #endif
 
+#if PIC_USE_READ
+/* push reader: feed bytes in arbitrary chunks, get back a list of the datums completed */
+pic_value pic_make_push_reader(pic_state *);
+pic_value pic_push_reader_feed(pic_state *, pic_value reader, const char *buf, int len);
+#endif
+
 #if PIC_USE_FILE
 pic_value pic_fopen(pic_state *, FILE *, const char *mode);
 #endif
 
 #if PIC_USE_ERROR
+PIC_NORETURN void pic_raise(pic_state *, pic_value);
+
 # define pic_try pic_try_(PIC_GENSYM(jmp))
 # define pic_try_(jmp)                                                  \
   do {                                                                  \
@@ -76,6 +76,21 @@
 # define PIC_GC_PERIOD (8 * 1024 * 1024)
 #endif
 
+/* a substring is copied out of its buffer on GC when it is the only
+   reference left and covers less than 1/PIC_SLICE_RATIO of the buffer */
+#ifndef PIC_SLICE_RATIO
+# define PIC_SLICE_RATIO 8
+#endif
+
+/* scan hash table control bytes 16 at a time with SSE2 */
+#ifndef PIC_USE_SSE2
+# if defined(__SSE2__) && PIC_USE_LIBC
+#  define PIC_USE_SSE2 1
+# else
+#  define PIC_USE_SSE2 0
+# endif
+#endif
+
 /* check compatibility */
 
 #if __STDC_VERSION__ >= 199901L
@@ -321,6 +336,19 @@ memcmp(const void *b1, const void *b2, size_t n)
   return (unsigned)*s1 - (unsigned)*s2;
 }
 
+PIC_STATIC_INLINE void *
+memchr(const void *b, int c, size_t n)
+{
+  const unsigned char *s = b;
+
+  while (n-- > 0) {
+    if (*s == (unsigned char)c)
+      return (void *)s;
+    s++;
+  }
+  return NULL;
+}
+
 PIC_STATIC_INLINE char *
 strcpy(char *dst, const char *src)
 {
@@ -397,22 +425,40 @@ atof(const char *nptr)
 
 #endif
 
+#if PIC_USE_LIBC
+
+double emyg_atod(const char *);
+
+/* correctly rounded */
+PIC_STATIC_INLINE double
+pic_atod(const char *str)
+{
+  return emyg_atod(str);
+}
+
+#else
+
 PIC_STATIC_INLINE double
 pic_atod(const char *str)
 {
   return atof(str);
 }
 
+#endif
+
 #if PIC_USE_FILE
 # include <stdio.h>
 #endif
 
 #if PIC_USE_LIBC
 
+void emyg_dtoa(double, char *);
+
+/* shortest representation that reads back to the same double */
 PIC_STATIC_INLINE void
 pic_dtoa(double dval, char *buf)
 {
-  sprintf(buf, "%g", dval);
+  emyg_dtoa(dval, buf);
 }
 
 #else
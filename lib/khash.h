@@ -27,26 +27,196 @@
 #ifndef PICRIN_KHASH_H
 #define PICRIN_KHASH_H
 
-#define ac_isempty(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&2)
-#define ac_isdel(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&1)
-#define ac_iseither(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&3)
-#define ac_set_isdel_false(flag, i) (flag[i>>4]&=~(1ul<<((i&0xfU)<<1)))
-#define ac_set_isempty_false(flag, i) (flag[i>>4]&=~(2ul<<((i&0xfU)<<1)))
-#define ac_set_isboth_false(flag, i) (flag[i>>4]&=~(3ul<<((i&0xfU)<<1)))
-#define ac_set_isdel_true(flag, i) (flag[i>>4]|=1ul<<((i&0xfU)<<1))
+/*
+ * Open addressing in the style of Swiss tables. Every bucket has a control
+ * byte: empty, deleted, or the low 7 bits of the key's hash when occupied.
+ * A lookup compares the 7-bit tag against a whole group of control bytes
+ * at once (16 with SSE2, 8 otherwise) and only touches the keys whose tags
+ * match, and each key sits next to its value, so a hit usually costs two
+ * cache lines. The first group of control bytes is mirrored past the end
+ * so that a group can be loaded from any bucket without wrapping around.
+ */
+
+#if PIC_USE_SSE2
+# include <emmintrin.h>
+#endif
+
+#define AC_EMPTY ((signed char) -128)
+#define AC_DELETED ((signed char) -2)
+#if PIC_USE_SSE2
+# define AC_GROUP 16
+#else
+# define AC_GROUP 8
+#endif
+#define AC_MIN_BUCKETS AC_GROUP
+
+#define ac_isfull(ctrl, i) ((ctrl)[i] >= 0)
+#define ac_hash_upper(x) ((x) - (x) / 8)
 
 #define ac_roundup32(x)                                                 \
   (--(x), (x)|=(x)>>1, (x)|=(x)>>2, (x)|=(x)>>4, (x)|=(x)>>8, (x)|=(x)>>16, ++(x))
 
-#define ac_fsize(m) ((m) < 16? 1 : (m)>>4)
-#define ac_hash_upper(x) ((((x) * 2) * 77 / 100 + 1) / 2)
+#if PIC_USE_SSE2
+
+/* bit i is set if ctrl[i] == c */
+PIC_STATIC_INLINE unsigned
+ac_group_match(const signed char *ctrl, signed char c)
+{
+  __m128i g = _mm_loadu_si128((const __m128i *) ctrl);
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(c)));
+}
+
+/* bit i is set iff ctrl[i] is empty */
+PIC_STATIC_INLINE unsigned
+ac_group_empty(const signed char *ctrl)
+{
+  return ac_group_match(ctrl, AC_EMPTY);
+}
+
+/* bit i is set iff ctrl[i] is empty or deleted */
+PIC_STATIC_INLINE unsigned
+ac_group_free(const signed char *ctrl)
+{
+  return _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) ctrl));
+}
+
+#else
+
+/* the same for a group of eight, four control bytes at a time in a 32-bit word */
+
+PIC_STATIC_INLINE uint32_t
+ac_load32(const signed char *ctrl)
+{
+  const unsigned char *u = (const unsigned char *) ctrl;
+  return u[0] | (uint32_t) u[1] << 8 | (uint32_t) u[2] << 16 | (uint32_t) u[3] << 24;
+}
+
+/* gathers the high bit of each byte into the low four bits */
+#define ac_msbs(x) ((((x) >> 7) & 1) | (((x) >> 14) & 2) | (((x) >> 21) & 4) | (((x) >> 28) & 8))
+
+/* may report false positives; callers compare the keys anyway */
+PIC_STATIC_INLINE unsigned
+ac_group_match(const signed char *ctrl, signed char c)
+{
+  uint32_t pat = 0x01010101U * (unsigned char) c, x;
+  unsigned m = 0;
+  int i;
+
+  for (i = 0; i < AC_GROUP; i += 4) {
+    x = ac_load32(ctrl + i) ^ pat;
+    m |= (unsigned) ac_msbs((x - 0x01010101U) & ~x & 0x80808080U) << i;
+  }
+  return m;
+}
+
+/* empty is the only control byte with the high bit set and bit 1 clear */
+PIC_STATIC_INLINE unsigned
+ac_group_empty(const signed char *ctrl)
+{
+  uint32_t x;
+  unsigned m = 0;
+  int i;
+
+  for (i = 0; i < AC_GROUP; i += 4) {
+    x = ac_load32(ctrl + i);
+    m |= (unsigned) ac_msbs(x & ~(x << 6) & 0x80808080U) << i;
+  }
+  return m;
+}
+
+PIC_STATIC_INLINE unsigned
+ac_group_free(const signed char *ctrl)
+{
+  uint32_t x;
+  unsigned m = 0;
+  int i;
+
+  for (i = 0; i < AC_GROUP; i += 4) {
+    x = ac_load32(ctrl + i);
+    m |= (unsigned) ac_msbs(x & 0x80808080U) << i;
+  }
+  return m;
+}
+
+#endif
+
+PIC_STATIC_INLINE int
+ac_ctz(unsigned m)
+{
+#if __GNUC__ || __clang__
+  return __builtin_ctz(m);
+#else
+  int n = 0;
+  while ((m & 1) == 0) {
+    m >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+/* scramble the user hash so that both the tag and the bucket index are usable */
+PIC_STATIC_INLINE unsigned
+ac_mix(int k)
+{
+  unsigned h = (unsigned) k;
+  h ^= h >> 16;
+  h *= 0x85ebca6bU;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35U;
+  h ^= h >> 16;
+  return h;
+}
+
+PIC_STATIC_INLINE void
+ac_set_ctrl(signed char *ctrl, int n_buckets, int i, signed char c)
+{
+  ctrl[i] = c;
+  if (i < AC_GROUP) {
+    ctrl[n_buckets + i] = c;
+  }
+}
+
+/* a deleted bucket can become empty again if no probe ever saw a full group around it */
+PIC_STATIC_INLINE bool
+ac_can_empty(const signed char *ctrl, int mask, int i)
+{
+  unsigned before = ac_group_empty(ctrl + ((i - AC_GROUP) & mask));
+  unsigned after = ac_group_empty(ctrl + i);
+  int n = 0;
+
+  if (before == 0 || after == 0) {
+    return false;
+  }
+  while ((before & (1U << (AC_GROUP - 1 - n))) == 0) {
+    n++;
+  }
+  return n + ac_ctz(after) < AC_GROUP;
+}
+
+/* first empty or deleted bucket on the probe sequence of h */
+PIC_STATIC_INLINE int
+ac_find_free(const signed char *ctrl, int mask, unsigned h)
+{
+  int pos = (h >> 7) & mask, step = 0;
+  unsigned m;
+
+  while ((m = ac_group_free(ctrl + pos)) == 0) {
+    step += AC_GROUP;
+    pos = (pos + step) & mask;
+  }
+  return (pos + ac_ctz(m)) & mask;
+}
 
 #define KHASH_DECLARE(name, khkey_t, khval_t)                           \
+  typedef struct {                                                      \
+    khkey_t key;                                                        \
+    khval_t val;                                                        \
+  } kh_##name##_slot_t;                                                 \
   typedef struct {                                                      \
     int n_buckets, size, n_occupied, upper_bound;                       \
-    int *flags;                                                         \
-    khkey_t *keys;                                                      \
-    khval_t *vals;                                                      \
+    signed char *ctrl;          /* n_buckets + AC_GROUP bytes */        \
+    kh_##name##_slot_t *slots;                                          \
   } kh_##name##_t;                                                      \
   void kh_init_##name(kh_##name##_t *h);                                \
   void kh_destroy_##name(pic_state *, kh_##name##_t *h);                \
@@ -64,133 +234,104 @@
   }                                                                     \
   void kh_destroy_##name(pic_state *pic, kh_##name##_t *h)              \
   {                                                                     \
-    pic_free(pic, h->flags);                                            \
-    pic_free(pic, (void *)h->keys);                                     \
-    pic_free(pic, (void *)h->vals);                                     \
+    pic_free(pic, h->ctrl);                                             \
+    pic_free(pic, h->slots);                                            \
   }                                                                     \
   void kh_clear_##name(kh_##name##_t *h)                                \
   {                                                                     \
-    if (h->flags) {                                                     \
-      memset(h->flags, 0xaa, ac_fsize(h->n_buckets) * sizeof(int));     \
+    if (h->ctrl) {                                                      \
+      memset(h->ctrl, AC_EMPTY, h->n_buckets + AC_GROUP);               \
       h->size = h->n_occupied = 0;                                      \
     }                                                                   \
   }                                                                     \
-  int kh_get_##name(pic_state *pic, const kh_##name##_t *h, khkey_t key) \
+  static int kh_lookup_##name(pic_state *pic, const kh_##name##_t *h, khkey_t key, unsigned hash) \
   {                                                                     \
+    unsigned m;                                                         \
+    int pos, step = 0, mask = h->n_buckets - 1, i;                      \
+    signed char tag = hash & 0x7f;                                      \
     (void)pic;                                                          \
-    if (h->n_buckets) {                                                 \
-      int k, i, last, mask, step = 0;                                   \
-      mask = h->n_buckets - 1;                                          \
-      k = hash_func(key); i = k & mask;                                 \
-      last = i;                                                         \
-      while (!ac_isempty(h->flags, i) && (ac_isdel(h->flags, i) || !hash_equal(h->keys[i], key))) { \
-        i = (i + (++step)) & mask;                                      \
-        if (i == last) return h->n_buckets;                             \
+    pos = (hash >> 7) & mask;                                           \
+    while (1) {                                                         \
+      m = ac_group_match(h->ctrl + pos, tag);                           \
+      while (m) {                                                       \
+        i = (pos + ac_ctz(m)) & mask;                                   \
+        if (hash_equal(h->slots[i].key, key)) return i;                 \
+        m &= m - 1;                                                     \
       }                                                                 \
-      return ac_iseither(h->flags, i)? h->n_buckets : i;		\
-    } else return 0;                                                    \
+      if (ac_group_empty(h->ctrl + pos)) return h->n_buckets;           \
+      step += AC_GROUP;                                                 \
+      pos = (pos + step) & mask;                                        \
+    }                                                                   \
+  }                                                                     \
+  int kh_get_##name(pic_state *pic, const kh_##name##_t *h, khkey_t key) \
+  {                                                                     \
+    if (h->n_buckets == 0) return 0;                                    \
+    return kh_lookup_##name(pic, h, key, ac_mix(hash_func(key)));       \
   }                                                                     \
   void kh_resize_##name(pic_state *pic, kh_##name##_t *h, int new_n_buckets) \
-  { /* This function uses 0.25*n_buckets bytes of working space instead of [sizeof(key_t+val_t)+.25]*n_buckets. */ \
-    int *new_flags = 0;                                                 \
-    int j = 1;                                                          \
-    {                                                                   \
-      ac_roundup32(new_n_buckets);                                      \
-      if (new_n_buckets < 4) new_n_buckets = 4;                         \
-      if (h->size >= ac_hash_upper(new_n_buckets)) j = 0; /* requested size is too small */ \
-      else { /* hash table size to be changed (shrink or expand); rehash */ \
-        new_flags = pic_malloc(pic, ac_fsize(new_n_buckets) * sizeof(int)); \
-        memset(new_flags, 0xaa, ac_fsize(new_n_buckets) * sizeof(int)); \
-        if (h->n_buckets < new_n_buckets) {	/* expand */		\
-          h->keys = pic_realloc(pic, (void *)h->keys, new_n_buckets * sizeof(khkey_t)); \
-          if (kh_is_map) {                                              \
-            h->vals = pic_realloc(pic, (void *)h->vals, new_n_buckets * sizeof(khval_t)); \
-          }                                                             \
-        } /* otherwise shrink */                                        \
-      }                                                                 \
-    }                                                                   \
-    if (j) { /* rehashing is needed */                                  \
-      for (j = 0; j != h->n_buckets; ++j) {                             \
-        if (ac_iseither(h->flags, j) == 0) {                            \
-          khkey_t key = h->keys[j];                                     \
-          khval_t val;                                                  \
-          int new_mask;                                                 \
-          new_mask = new_n_buckets - 1;                                 \
-          if (kh_is_map) val = h->vals[j];                              \
-          ac_set_isdel_true(h->flags, j);                               \
-          while (1) { /* kick-out process; sort of like in Cuckoo hashing */ \
-            int k, i, step = 0;                                         \
-            k = hash_func(key);                                         \
-            i = k & new_mask;                                           \
-            while (!ac_isempty(new_flags, i)) i = (i + (++step)) & new_mask; \
-            ac_set_isempty_false(new_flags, i);                         \
-            if (i < h->n_buckets && ac_iseither(h->flags, i) == 0) { /* kick out the existing element */ \
-              { khkey_t tmp = h->keys[i]; h->keys[i] = key; key = tmp; } \
-              if (kh_is_map) { khval_t tmp = h->vals[i]; h->vals[i] = val; val = tmp; } \
-              ac_set_isdel_true(h->flags, i); /* mark it as deleted in the old hash table */ \
-            } else { /* write the element and jump out of the loop */   \
-              h->keys[i] = key;                                         \
-              if (kh_is_map) h->vals[i] = val;                          \
-              break;                                                    \
-            }                                                           \
-          }                                                             \
-        }                                                               \
-      }                                                                 \
-      if (h->n_buckets > new_n_buckets) { /* shrink the hash table */   \
-        h->keys = pic_realloc(pic, (void *)h->keys, new_n_buckets * sizeof(khkey_t)); \
-        if (kh_is_map) h->vals = pic_realloc(pic, (void *)h->vals, new_n_buckets * sizeof(khval_t)); \
+  {                                                                     \
+    signed char *ctrl = h->ctrl;                                        \
+    kh_##name##_slot_t *slots = h->slots;                               \
+    int j, n = h->n_buckets;                                            \
+    ac_roundup32(new_n_buckets);                                        \
+    if (new_n_buckets < AC_MIN_BUCKETS) new_n_buckets = AC_MIN_BUCKETS; \
+    if (h->size >= ac_hash_upper(new_n_buckets)) return; /* requested size is too small */ \
+    h->ctrl = pic_malloc(pic, new_n_buckets + AC_GROUP);                \
+    memset(h->ctrl, AC_EMPTY, new_n_buckets + AC_GROUP);                \
+    h->slots = pic_malloc(pic, new_n_buckets * sizeof(kh_##name##_slot_t)); \
+    h->n_buckets = new_n_buckets;                                       \
+    h->n_occupied = h->size;                                            \
+    h->upper_bound = ac_hash_upper(new_n_buckets);                      \
+    for (j = 0; j != n; ++j) {                                          \
+      if (ac_isfull(ctrl, j)) {                                         \
+        unsigned hash = ac_mix(hash_func(slots[j].key));                \
+        int i = ac_find_free(h->ctrl, new_n_buckets - 1, hash);         \
+        ac_set_ctrl(h->ctrl, new_n_buckets, i, hash & 0x7f);            \
+        h->slots[i] = slots[j];                                         \
       }                                                                 \
-      pic_free(pic, h->flags); /* free the working space */             \
-      h->flags = new_flags;                                             \
-      h->n_buckets = new_n_buckets;                                     \
-      h->n_occupied = h->size;                                          \
-      h->upper_bound = ac_hash_upper(h->n_buckets);                     \
     }                                                                   \
+    pic_free(pic, ctrl);                                                \
+    pic_free(pic, slots);                                               \
   }                                                                     \
   int kh_put_##name(pic_state *pic, kh_##name##_t *h, khkey_t key, int *ret) \
   {                                                                     \
     int x;                                                              \
+    unsigned hash = ac_mix(hash_func(key));                             \
+    if (h->n_buckets != 0) {                                            \
+      x = kh_lookup_##name(pic, h, key, hash);                          \
+      if (x != h->n_buckets) {                                          \
+        *ret = 0; /* Don't touch h->slots[x].key if present */          \
+        return x;                                                       \
+      }                                                                 \
+    }                                                                   \
     if (h->n_occupied >= h->upper_bound) { /* update the hash table */  \
       if (h->n_buckets > (h->size<<1)) {                                \
         kh_resize_##name(pic, h, h->n_buckets - 1); /* clear "deleted" elements */ \
       } else {                                                          \
         kh_resize_##name(pic, h, h->n_buckets + 1); /* expand the hash table */ \
       }                                                                 \
-    } /* TODO: to implement automatically shrinking; resize() already support shrinking */ \
-    {                                                                   \
-      int k, i, site, last, mask = h->n_buckets - 1, step = 0;          \
-      x = site = h->n_buckets; k = hash_func(key); i = k & mask;        \
-      if (ac_isempty(h->flags, i)) x = i; /* for speed up */            \
-      else {                                                            \
-        last = i;                                                       \
-        while (!ac_isempty(h->flags, i) && (ac_isdel(h->flags, i) || !hash_equal(h->keys[i], key))) { \
-          if (ac_isdel(h->flags, i)) site = i;                          \
-          i = (i + (++step)) & mask;                                    \
-          if (i == last) { x = site; break; }                           \
-        }                                                               \
-        if (x == h->n_buckets) {                                        \
-          if (ac_isempty(h->flags, i) && site != h->n_buckets) x = site; \
-          else x = i;                                                   \
-        }                                                               \
-      }                                                                 \
     }                                                                   \
-    if (ac_isempty(h->flags, x)) { /* not present at all */		\
-      h->keys[x] = key;                                                 \
-      ac_set_isboth_false(h->flags, x);                                 \
-      ++h->size; ++h->n_occupied;                                       \
+    x = ac_find_free(h->ctrl, h->n_buckets - 1, hash);                  \
+    if (h->ctrl[x] == AC_EMPTY) { /* not present at all */              \
+      ++h->n_occupied;                                                  \
       *ret = 1;                                                         \
-    } else if (ac_isdel(h->flags, x)) { /* deleted */                   \
-      h->keys[x] = key;                                                 \
-      ac_set_isboth_false(h->flags, x);                                 \
-      ++h->size;                                                        \
+    } else { /* deleted */                                              \
       *ret = 2;                                                         \
-    } else *ret = 0; /* Don't touch h->keys[x] if present and not deleted */ \
+    }                                                                   \
+    ac_set_ctrl(h->ctrl, h->n_buckets, x, hash & 0x7f);                 \
+    h->slots[x].key = key;                                              \
+    ++h->size;                                                          \
     return x;                                                           \
   }                                                                     \
   void kh_del_##name(kh_##name##_t *h, int x)                           \
   {                                                                     \
-    if (x != h->n_buckets && !ac_iseither(h->flags, x)) {               \
-      ac_set_isdel_true(h->flags, x);                                   \
+    if (x != h->n_buckets && ac_isfull(h->ctrl, x)) {                   \
+      if (ac_can_empty(h->ctrl, h->n_buckets - 1, x)) {                 \
+        ac_set_ctrl(h->ctrl, h->n_buckets, x, AC_EMPTY);                \
+        --h->n_occupied;                                                \
+      } else {                                                          \
+        ac_set_ctrl(h->ctrl, h->n_buckets, x, AC_DELETED);              \
+      }                                                                 \
       --h->size;                                                        \
     }                                                                   \
   }
@@ -222,10 +363,10 @@ PIC_STATIC_INLINE int kh_str_hash_func(const char *s) {
 #define kh_get(name, h, k) kh_get_##name(pic, h, k)
 #define kh_del(name, h, k) kh_del_##name(h, k)
 
-#define kh_exist(h, x) (!ac_iseither((h)->flags, (x)))
-#define kh_key(h, x) ((h)->keys[x])
-#define kh_val(h, x) ((h)->vals[x])
-#define kh_value(h, x) ((h)->vals[x])
+#define kh_exist(h, x) (ac_isfull((h)->ctrl, (x)))
+#define kh_key(h, x) ((h)->slots[x].key)
+#define kh_val(h, x) ((h)->slots[x].val)
+#define kh_value(h, x) ((h)->slots[x].val)
 #define kh_begin(h) (0)
 #define kh_end(h) ((h)->n_buckets)
 #define kh_size(h) ((h)->size)
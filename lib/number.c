@@ -226,59 +226,202 @@ pic_number_number_to_string(pic_state *pic)
   }
 }
 
-static bool
-strcaseeq(const char *s1, const char *s2)
+enum {
+  NOT_A_NUMBER,
+  EXACT_INTEGER,
+  INEXACT_REAL
+};
+
+static int
+digit_value(int c)
 {
-  char a, b;
+  if (isdigit(c)) {
+    return c - '0';
+  }
+  c = tolower(c);
+  if ('a' <= c && c <= 'z') {
+    return c - 'a' + 10;
+  }
+  return 36;
+}
 
-  while ((a = *s1++) * (b = *s2++)) {
-    if (tolower(a) != tolower(b))
-      return false;
+static bool
+read_infnan(const char *s, const char *e, double *f)
+{
+  if (e - s != 5 || s[3] != '.' || s[4] != '0') {
+    return false;
+  }
+  if (tolower(s[0]) == 'i' && tolower(s[1]) == 'n' && tolower(s[2]) == 'f') {
+    *f = 1.0 / 0.0;
+    return true;
+  }
+  if (tolower(s[0]) == 'n' && tolower(s[1]) == 'a' && tolower(s[2]) == 'n') {
+    *f = 0.0 / 0.0;
+    return true;
   }
-  return a == b;
+  return false;
 }
 
-static pic_value
-string_to_number(pic_state *pic, const char *str)
+/* digits [. digits] [e [sign] digits], where at least one digit precedes the exponent */
+static int
+read_decimal(pic_state *pic, const char *s, const char *e, double *f)
 {
-  double flt;
-  const char *c = str;
-  bool isint = 1;
+  const char *p = s;
+  char buf[64], *tmp;
+  int n = 0;
 
-  if (*c == '+' || *c == '-')
-    c++;
+  while (p < e && isdigit((unsigned char) *p)) {
+    p++, n++;
+  }
+  if (p < e && *p == '.') {
+    p++;
+    while (p < e && isdigit((unsigned char) *p)) {
+      p++, n++;
+    }
+  }
+  if (n == 0) {
+    return NOT_A_NUMBER;
+  }
+  if (p < e && (*p == 'e' || *p == 'E')) {
+    p++;
+    if (p < e && (*p == '+' || *p == '-')) {
+      p++;
+    }
+    if (! (p < e && isdigit((unsigned char) *p))) {
+      return NOT_A_NUMBER;
+    }
+    while (p < e && isdigit((unsigned char) *p)) {
+      p++;
+    }
+  }
+  if (p != e) {
+    return NOT_A_NUMBER;
+  }
 
-  if (! isdigit(*c++)) {
-    return pic_false_value(pic);
+  n = e - s;
+  tmp = n < (int) sizeof buf ? buf : pic_malloc(pic, n + 1);
+  memcpy(tmp, s, n);
+  tmp[n] = '\0';
+  *f = pic_atod(tmp);
+  if (tmp != buf) {
+    pic_free(pic, tmp);
   }
-  while (isdigit(*c)) c++;
+  return INEXACT_REAL;
+}
 
-  if (*c == '.') {
-    isint = false;
-    c++;
-    while (isdigit(*c)) c++;
+static int
+read_real(pic_state *pic, const char *s, const char *e, int radix, double *f)
+{
+  unsigned long u = 0, limit = INT_MAX;
+  bool neg = false;
+  const char *p;
+  double d;
+  int v;
+
+  if (s < e && (*s == '+' || *s == '-')) {
+    neg = *s++ == '-';
+    if (read_infnan(s, e, f)) {
+      if (neg) {
+        *f = -*f;
+      }
+      return INEXACT_REAL;
+    }
+    limit += neg;
   }
-  if (*c == 'e' || *c == 'E') {
-    isint = false;
-    c++;
-    if (*c == '+' || *c == '-')
-      c++;
-    if (! isdigit(*c++)) {
-      return pic_false_value(pic);
+  if (s == e) {
+    return NOT_A_NUMBER;
+  }
+
+  for (p = s; p < e && (v = digit_value((unsigned char) *p)) < radix; ++p) {
+    if (u > (limit - v) / radix) {
+      break;
     }
-    while (isdigit(*c)) c++;
+    u = u * radix + v;
+  }
+  if (p == e) {
+    *f = neg ? -(double) u : (double) u;
+    return EXACT_INTEGER;
   }
 
-  if (*c != '\0') {
-    return pic_false_value(pic);
+  /* a decimal point, an exponent, or too many digits for a fixnum */
+  if (radix == 10) {
+    v = read_decimal(pic, s, e, f);
+    if (neg) {
+      *f = -*f;
+    }
+    return v;
   }
 
-  flt = pic_atod(str);
+  d = u;
+  for (; p < e && (v = digit_value((unsigned char) *p)) < radix; ++p) {
+    d = d * radix + v;
+  }
+  if (p != e) {
+    return NOT_A_NUMBER;
+  }
+  *f = neg ? -d : d;
+  return INEXACT_REAL;
+}
+
+pic_value
+pic_str_to_number(pic_state *pic, const char *str, int len, int radix)
+{
+  const char *s = str, *e = str + len;
+  int exactness = 0, i, n;
+  bool radix_seen = false;
+  double f;
 
-  if (isint && INT_MIN <= flt && flt <= INT_MAX) {
-    return pic_int_value(pic, flt);
-  } else {
-    return pic_float_value(pic, flt);
+  /* fast path: short decimal integers always fit in a fixnum */
+  if (radix == 10 && len < 10) {
+    i = (len > 0 && (str[0] == '+' || str[0] == '-'));
+    if (i < len) {
+      for (n = 0; i < len && isdigit((unsigned char) str[i]); ++i) {
+        n = n * 10 + (str[i] - '0');
+      }
+      if (i == len) {
+        return pic_int_value(pic, str[0] == '-' ? -n : n);
+      }
+    }
+  }
+
+  while (e - s >= 2 && s[0] == '#') {
+    switch (tolower((unsigned char) s[1])) {
+    case 'b': radix = 2;  goto set_radix;
+    case 'o': radix = 8;  goto set_radix;
+    case 'd': radix = 10; goto set_radix;
+    case 'x': radix = 16;
+    set_radix:
+      if (radix_seen) {
+        return pic_false_value(pic);
+      }
+      radix_seen = true;
+      break;
+    case 'e': case 'i':
+      if (exactness) {
+        return pic_false_value(pic);
+      }
+      exactness = tolower((unsigned char) s[1]);
+      break;
+    default:
+      return pic_false_value(pic);
+    }
+    s += 2;
+  }
+
+  switch (read_real(pic, s, e, radix, &f)) {
+  case NOT_A_NUMBER:
+    return pic_false_value(pic);
+  case EXACT_INTEGER:
+    if (exactness != 'i' && INT_MIN <= f && f <= INT_MAX) {
+      return pic_int_value(pic, (int) f);
+    }
+    return pic_float_value(pic, f);
+  default:
+    /* no rationals: #e truncates like exact, and values beyond a fixnum stay inexact */
+    if (exactness == 'e' && INT_MIN <= f && f <= INT_MAX) {
+      return pic_int_value(pic, (int) f);
+    }
+    return pic_float_value(pic, f);
   }
 }
 
@@ -287,26 +430,14 @@ pic_number_string_to_number(pic_state *pic)
 {
   const char *str;
   int radix = 10;
-  long num;
-  char *eptr;
 
   pic_get_args(pic, "z|i", &str, &radix);
 
-  if (strcaseeq(str, "+inf.0"))
-    return pic_float_value(pic, 1.0 / 0.0);
-  if (strcaseeq(str, "-inf.0"))
-    return pic_float_value(pic, -1.0 / 0.0);
-  if (strcaseeq(str, "+nan.0"))
-    return pic_float_value(pic, 0.0 / 0.0);
-  if (strcaseeq(str, "-nan.0"))
-    return pic_float_value(pic, -0.0 / 0.0);
-
-  num = strtol(str, &eptr, radix);
-  if (*eptr == '\0') {
-    return INT_MIN <= num && num <= INT_MAX ? pic_int_value(pic, num) : pic_float_value(pic, num);
+  if (radix < 2 || radix > 36) {
+    pic_error(pic, "invalid radix (between 2 and 36, inclusive)", 1, pic_int_value(pic, radix));
   }
 
-  return string_to_number(pic, str);
+  return pic_str_to_number(pic, str, strlen(str), radix);
 }
 
 void
@@ -41,6 +41,14 @@ struct rope_leaf {
   const char *str;
 };
 
+/* a substring sharing the buffer of base; str is not NUL-terminated */
+struct rope_slice {
+  ROPE_HEADER
+  const char *str;
+  struct rope_leaf *base;
+  struct rope_slice *prev;      /* for GC */
+};
+
 struct rope_node {
   ROPE_HEADER
   struct rope *s1;
@@ -76,6 +84,21 @@ struct dict {
   khash_t(dict) hash;
 };
 
+struct bucket {
+  unsigned hash;                /* 0 = empty, 1 = deleted */
+  pic_value key, val;
+};
+
+struct table {
+  OBJECT_HEADER
+  int kind;
+  pic_value equal, hash;        /* user-supplied comparator */
+  struct bucket *b;
+  int capa, used, size;         /* used counts tombstones too */
+  struct bucket *old;           /* buckets being migrated into b */
+  int old_capa, migrated;
+};
+
 KHASH_DECLARE(attr, struct object *, pic_value)
 
 struct attr {
@@ -90,10 +113,17 @@ struct data {
   void *data;
 };
 
+struct record_type {
+  OBJECT_HEADER
+  struct symbol *name;
+  pic_value fields;             /* list of field names */
+  int nfields;
+};
+
 struct record {
   OBJECT_HEADER
-  struct symbol *type;
-  pic_value datum;
+  struct record_type *type;
+  pic_value slots[1];           /* type->nfields slots allocated inline */
 };
 
 enum {
@@ -110,13 +140,18 @@ enum {
   OP_LOADF = 0x0A,        /* 0x0A 0x**            OP_LOADF dest     */
   OP_LOADN = 0x0B,        /* 0x0B 0x**            OP_LOADN dest     */
   OP_LOADU = 0x0C,        /* 0x0C 0x**            OP_LOADU dest     */
-  OP_LOADI = 0x0D         /* 0x0D 0x** 0x**       OP_LOADI dest i   */
+  OP_LOADI = 0x0D,        /* 0x0D 0x** 0x**       OP_LOADI dest i   */
+  OP_RREF  = 0x0E,        /* 0x0E 0x** 0x**       OP_RREF dest k    */
+  OP_RSET  = 0x0F,        /* 0x0F 0x** 0x**       OP_RSET dest k    */
+  OP_LREFX = 0x10,        /* 0x10 0x** 0x**** 0x** OP_LREFX dest n i */
+  OP_LSETX = 0x11         /* 0x11 0x** 0x**** 0x** OP_LSETX src n i  */
 };
 
 typedef unsigned char code_t;
 
 #define IREP_VARG 1
 #define IREP_CODE_STATIC 2
+#define IREP_LAZY 4             /* not decoded yet; see pic_force_irep */
 
 struct irep {
   OBJECT_HEADER
@@ -153,6 +188,9 @@ struct proc {
 #define TYPENAME_proc  "procedure"
 #define TYPENAME_str   "string"
 #define TYPENAME_vec   "vector"
+#define TYPENAME_table "hash table"
+#define TYPENAME_rec   "record"
+#define TYPENAME_rectype "record type"
 
 #define TYPE_CHECK(pic, v, type) do {                           \
     if (! pic_##type##_p(pic, v))                               \
@@ -198,23 +236,33 @@ DEFPTR(blob, struct blob)
 DEFPTR(pair, struct pair)
 DEFPTR(vec, struct vector)
 DEFPTR(dict, struct dict)
+DEFPTR(table, struct table)
 DEFPTR(attr, struct attr)
 DEFPTR(data, struct data)
 DEFPTR(proc, struct proc)
 DEFPTR(rec, struct record)
+DEFPTR(rectype, struct record_type)
 DEFPTR(irep, struct irep)
 #undef pic_data_p
 
 struct object *pic_obj_alloc(pic_state *, int type);
 struct object *pic_obj_alloc_unsafe(pic_state *, int type);
+struct object *pic_obj_alloc_sized(pic_state *, size_t size, int type); /* for variable-length objects */
 
 struct frame *pic_make_frame_unsafe(pic_state *, int n);
 pic_value pic_make_proc_irep_unsafe(pic_state *, struct irep *, struct frame *);
-pic_value pic_make_record(pic_state *, pic_value type, pic_value datum);
+void pic_force_irep(pic_state *, struct irep *);
+pic_value pic_make_record_type(pic_state *, pic_value name, pic_value fields);
+pic_value pic_make_record(pic_state *, pic_value type, int n, pic_value *slots);
 pic_value pic_record_type(pic_state *pic, pic_value record);
-pic_value pic_record_datum(pic_state *pic, pic_value record);
+int pic_record_len(pic_state *pic, pic_value record);
+pic_value pic_record_ref(pic_state *pic, pic_value record, int k);
 pic_value pic_make_cont(pic_state *pic, pic_value k);
+pic_value pic_mapk(pic_state *pic, int type, pic_value proc, int argc, pic_value *argv, bool collect);
+bool pic_attr_proc_p(pic_state *pic, pic_value proc);
+pic_value pic_make_str(pic_state *, char *buf, int len); /* takes ownership of buf[0..len] */
 int pic_str_hash(pic_state *pic, pic_value str);
+pic_value pic_str_to_number(pic_state *pic, const char *str, int len, int radix); /* #f if not a number */
 int pic_str_cmp(pic_state *pic, pic_value str1, pic_value str2);
 
 void pic_warnf(pic_state *pic, const char *fmt, ...); /* deprecated */
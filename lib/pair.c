@@ -466,60 +466,29 @@ pic_pair_list_copy(pic_state *pic)
 static pic_value
 pic_pair_map(pic_state *pic)
 {
-  int argc, i;
-  pic_value proc, *args, *arg_list, ret;
+  int argc;
+  pic_value proc, *args;
 
   pic_get_args(pic, "l*", &proc, &argc, &args);
 
   if (argc == 0)
     pic_error(pic, "map: wrong number of arguments (1 for at least 2)", 0);
 
-  arg_list = pic_alloca(pic, sizeof(pic_value) * argc);
-
-  ret = pic_nil_value(pic);
-  do {
-    for (i = 0; i < argc; ++i) {
-      if (! pic_pair_p(pic, args[i])) {
-        break;
-      }
-      arg_list[i] = pic_car(pic, args[i]);
-      args[i] = pic_cdr(pic, args[i]);
-    }
-
-    if (i != argc) {
-      break;
-    }
-    pic_push(pic, pic_apply(pic, proc, i, arg_list), ret);
-  } while (1);
-
-  return pic_reverse(pic, ret);
+  return pic_mapk(pic, PIC_TYPE_PAIR, proc, argc, args, true);
 }
 
 static pic_value
 pic_pair_for_each(pic_state *pic)
 {
-  int argc, i;
-  pic_value proc, *args, *arg_list;
+  int argc;
+  pic_value proc, *args;
 
   pic_get_args(pic, "l*", &proc, &argc, &args);
 
-  arg_list = pic_alloca(pic, sizeof(pic_value) * argc);
-
-  do {
-    for (i = 0; i < argc; ++i) {
-      if (! pic_pair_p(pic, args[i])) {
-        break;
-      }
-      arg_list[i] = pic_car(pic, args[i]);
-      args[i] = pic_cdr(pic, args[i]);
-    }
-    if (i != argc) {
-      break;
-    }
-    pic_apply(pic, proc, i, arg_list);
-  } while (1);
+  if (argc == 0)
+    pic_error(pic, "for-each: wrong number of arguments (1 for at least 2)", 0);
 
-  return pic_undef_value(pic);
+  return pic_mapk(pic, PIC_TYPE_PAIR, proc, argc, args, false);
 }
 
 static pic_value
@@ -3,10 +3,26 @@
  */
 
 #include <picrin.h>
+#include <picrin/extra.h>
 #include "value.h"
 #include "object.h"
 #include "state.h"
 
+/* LREF and LSET take a two-byte depth (LREFX and LSETX) beyond 255 */
+static int
+insn_length(pic_state *pic, pic_value r)
+{
+  pic_value op = pic_car(pic, r);
+
+  if (pic_eq_p(pic, op, pic_intern_lit(pic, "COND"))) {
+    return 4;
+  }
+  if (pic_eq_p(pic, op, pic_intern_lit(pic, "LREF")) || pic_eq_p(pic, op, pic_intern_lit(pic, "LSET"))) {
+    return pic_int(pic, pic_list_ref(pic, r, 2)) < 256 ? 4 : 5;
+  }
+  return pic_length(pic, r);
+}
+
 static struct irep *
 assemble(pic_state *pic, pic_value as)
 {
@@ -46,11 +62,7 @@ assemble(pic_state *pic, pic_value as)
   pic_for_each (r, codes, it) {
     if (! pic_pair_p(pic, r))
       continue;
-    if (pic_eq_p(pic, pic_car(pic, r), pic_intern_lit(pic, "COND"))) {
-      i += 4;
-      continue;
-    }
-    i += pic_length(pic, r);
+    i += insn_length(pic, r);
   }
   code = pic_malloc(pic, i);
   i = 0;
@@ -78,15 +90,23 @@ assemble(pic_state *pic, pic_value as)
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
     }
     else if (pic_eq_p(pic, op, pic_intern_lit(pic, "LREF"))) {
-      code[i++] = OP_LREF;
+      int depth = pic_int(pic, pic_list_ref(pic, r, 2));
+      code[i++] = depth < 256 ? OP_LREF : OP_LREFX;
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
-      code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
+      code[i++] = depth % 256;
+      if (depth >= 256) {
+        code[i++] = depth / 256;
+      }
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 3));
     }
     else if (pic_eq_p(pic, op, pic_intern_lit(pic, "LSET"))) {
-      code[i++] = OP_LSET;
+      int depth = pic_int(pic, pic_list_ref(pic, r, 2));
+      code[i++] = depth < 256 ? OP_LSET : OP_LSETX;
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
-      code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
+      code[i++] = depth % 256;
+      if (depth >= 256) {
+        code[i++] = depth / 256;
+      }
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 3));
     }
     else if (pic_eq_p(pic, op, pic_intern_lit(pic, "GREF"))) {
@@ -108,11 +128,7 @@ assemble(pic_state *pic, pic_value as)
           break;
         if (! pic_pair_p(pic, x))
           continue;
-        if (pic_eq_p(pic, pic_car(pic, x), pic_intern_lit(pic, "COND"))) {
-          offset += 4;
-          continue;
-        }
-        offset += pic_length(pic, x);
+        offset += insn_length(pic, x);
       }
       code[i++] = OP_COND;
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
@@ -140,6 +156,16 @@ assemble(pic_state *pic, pic_value as)
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
     }
+    else if (pic_eq_p(pic, op, pic_intern_lit(pic, "RREF"))) {
+      code[i++] = OP_RREF;
+      code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
+      code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
+    }
+    else if (pic_eq_p(pic, op, pic_intern_lit(pic, "RSET"))) {
+      code[i++] = OP_RSET;
+      code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
+      code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
+    }
   }
 
   ir = (struct irep *)pic_obj_alloc(pic, PIC_TYPE_IREP);
@@ -250,6 +276,7 @@ arg_error(pic_state *pic, int actual, bool varg, int expected)
  *  s   pic_value *             string
  *  l   pic_value *             lambda
  *  d   pic_value *             dictionary
+ *  h   pic_value *             hash table
  *  r   pic_value *             record
  *
  *  +                           aliasing operator
@@ -420,6 +447,7 @@ pic_get_args(pic_state *pic, const char *format, ...)
     OBJ_CASE('l', proc)
     OBJ_CASE('v', vec)
     OBJ_CASE('d', dict)
+    OBJ_CASE('h', table)
     OBJ_CASE('r', rec)
 
     default:
@@ -527,6 +555,91 @@ pic_applyk(pic_state *pic, pic_value proc, int argc, pic_value *argv)
   return pic_invalid_value(pic);
 }
 
+/*
+ * One-shot continuations for schedulers written in C. pic_currentk takes
+ * the continuation of the C function being called; a C function called
+ * later in the same context may then pass values to it with pic_resumek
+ * in place of returning its own. No setjmp is involved, and for that
+ * very reason a continuation cannot be resumed across a C frame: only
+ * from the context it was taken in, while that context is running.
+ */
+
+struct k {
+  struct context *cxt;
+  unsigned long id;
+  bool foreign;
+  pic_value k;                  /* #f once resumed */
+  pic_value dyn_env;
+};
+
+static void
+k_dtor(pic_state *pic, void *data)
+{
+  pic_free(pic, data);
+}
+
+static void
+k_mark(pic_state *pic, void *data, void (*mark)(pic_state *, pic_value))
+{
+  struct k *k = data;
+
+  mark(pic, k->k);
+  mark(pic, k->dyn_env);
+}
+
+static const pic_data_type k_type = { "continuation", k_dtor, k_mark };
+
+pic_value
+pic_currentk(pic_state *pic)
+{
+  struct k *k;
+
+  if (pic->cxt->fp == NULL) {
+    pic_error(pic, "pic_currentk: no C function is being called", 0);
+  }
+  k = pic_malloc(pic, sizeof(struct k));
+  k->cxt = pic->cxt;
+  k->id = pic->cxt->id;
+  k->foreign = pic->cxt->foreign;
+  k->k = GET_CONT(pic);
+  k->dyn_env = pic->dyn_env;
+  CAPTURED(pic);
+  return pic_data_value(pic, k, &k_type);
+}
+
+bool
+pic_resumable_p(pic_state *pic, pic_value k)
+{
+  struct k *c;
+
+  if (! pic_data_p(pic, k, &k_type)) {
+    return false;
+  }
+  c = pic_data(pic, k);
+  return ! pic_false_p(pic, c->k) && c->cxt == pic->cxt && c->id == pic->cxt->id;
+}
+
+pic_value
+pic_resumek(pic_state *pic, pic_value k, int n, pic_value *argv)
+{
+  struct k *c;
+  pic_value cont;
+
+  if (! pic_resumable_p(pic, k)) {
+    if (pic_data_p(pic, k, &k_type) && pic_false_p(pic, ((struct k *) pic_data(pic, k))->k)) {
+      pic_error(pic, "continuation resumed twice", 0);
+    }
+    pic_error(pic, "continuation resumed across a C call", 1, k);
+  }
+  c = pic_data(pic, k);
+  cont = c->k;
+  c->k = pic_false_value(pic);
+  pic->cxt->foreign = c->foreign;
+  pic_dynenv_reroot(pic, c->dyn_env);
+  CONTEXT_INIT(pic, pic->cxt, cont, n, argv);
+  return pic_invalid_value(pic);
+}
+
 pic_value
 pic_values(pic_state *pic, int n, ...)
 {
@@ -555,7 +668,10 @@ pic_vm(pic_state *pic, struct context *cxt)
   assert(cxt->fp == NULL);
   assert(cxt->irep == NULL);
 
-  cxt->conts = pic_nil_value(pic);
+  if (cxt != pic->budget) {    /* a task keeps its id across slices */
+    cxt->id = ++pic->cxt_id;
+    cxt->foreign = false;
+  }
   cxt->prev = pic->cxt;
   pic->cxt = cxt;
 
@@ -568,9 +684,17 @@ pic_vm(pic_state *pic, struct context *cxt)
 #define A (cxt->pc[1])
 #define B (cxt->pc[2])
 #define C (cxt->pc[3])
+#define D (cxt->pc[4])
 #define Bx ((C << 8) + B)
 #define REG(i) (cxt->sp->regs[i])
 
+#define RECORD_CHECK(r, t, k) do {                                       \
+    if (! (pic_rec_p(pic, r) && pic_eq_p(pic, obj_value(pic, rec_ptr(pic, r)->type), t))) { \
+      pic_error(pic, "record type mismatch", 2, r, t);                  \
+    }                                                                   \
+    VALID_INDEX(pic, rec_ptr(pic, r)->type->nfields, k);                \
+  } while (0)
+
 #if PIC_DIRECT_THREADED_VM
 # define VM_LOOP JUMP;
 # define CASE(x) L_##x:
@@ -591,21 +715,34 @@ pic_vm(pic_state *pic, struct context *cxt)
     [OP_LOAD] = &&L_OP_LOAD, [OP_LREF] = &&L_OP_LREF, [OP_LSET] = &&L_OP_LSET,
     [OP_GREF] = &&L_OP_GREF, [OP_GSET] = &&L_OP_GSET, [OP_COND] = &&L_OP_COND,
     [OP_LOADT] = &&L_OP_LOADT, [OP_LOADF] = &&L_OP_LOADF, [OP_LOADN] = &&L_OP_LOADN,
-    [OP_LOADU] = &&L_OP_LOADU, [OP_LOADI] = &&L_OP_LOADI
+    [OP_LOADU] = &&L_OP_LOADU, [OP_LOADI] = &&L_OP_LOADI,
+    [OP_RREF] = &&L_OP_RREF, [OP_RSET] = &&L_OP_RSET,
+    [OP_LREFX] = &&L_OP_LREFX, [OP_LSETX] = &&L_OP_LSETX
   };
 #endif
 
   VM_LOOP {
     CASE(OP_HALT) {
-      pic_value c, it;
-      pic_for_each (c, pic->cxt->conts, it) {
-        proc_ptr(pic, c)->env->regs[0] = pic_false_value(pic);
+      if (cxt->foreign) {
+        cxt->foreign = false;
+        pic_error(pic, "re-entered continuation returned to a C call that has exited", 0);
       }
       pic->cxt = pic->cxt->prev;
       return;
     }
     CASE(OP_CALL) {
       struct proc *proc;
+      if (pic->fuel >= 0 && --pic->fuel < 0) {
+        if (cxt == pic->budget) {
+          /* out of fuel: leave the call in sp for pic_run to resume */
+          cxt->fp = NULL;
+          cxt->irep = NULL;
+          SAVE;
+          pic->cxt = cxt->prev;
+          return;
+        }
+        pic->fuel = 0;          /* stop as soon as control is back in budget */
+      }
       if (! pic_proc_p(pic, REG(0))) {
         pic_error(pic, "invalid application", 1, REG(0));
       }
@@ -656,6 +793,13 @@ pic_vm(pic_state *pic, struct context *cxt)
       REG(A) = f->regs[C];
       NEXT(4);
     }
+    CASE(OP_LREFX) {
+      struct frame *f;
+      int depth = Bx;
+      for (f = cxt->fp; depth--; f = f->up);
+      REG(A) = f->regs[D];
+      NEXT(5);
+    }
     CASE(OP_LSET) {
       struct frame *f;
       int depth = B;
@@ -663,6 +807,13 @@ pic_vm(pic_state *pic, struct context *cxt)
       f->regs[C] = REG(A);
       NEXT(4);
     }
+    CASE(OP_LSETX) {
+      struct frame *f;
+      int depth = Bx;
+      for (f = cxt->fp; depth--; f = f->up);
+      f->regs[D] = REG(A);
+      NEXT(5);
+    }
     CASE(OP_GREF) {
       REG(A) = pic_global_ref(pic, cxt->irep->obj[B]);
       NEXT(3);
@@ -679,6 +830,9 @@ pic_vm(pic_state *pic, struct context *cxt)
       }
     }
     CASE(OP_PROC) {
+      if (cxt->irep->irep[B]->flags & IREP_LAZY) {
+        pic_force_irep(pic, cxt->irep->irep[B]);
+      }
       REG(A) = pic_make_proc_irep_unsafe(pic, cxt->irep->irep[B], cxt->fp);
       NEXT(3);
     }
@@ -706,9 +860,156 @@ pic_vm(pic_state *pic, struct context *cxt)
       REG(A) = pic_int_value(pic, (signed char) B);
       NEXT(3);
     }
+    /* record slot access emitted by define-record-type: the record is in
+       REG(A) and its expected type descriptor in REG(A + 1) */
+    CASE(OP_RREF) {
+      RECORD_CHECK(REG(A), REG(A + 1), B);
+      REG(A) = rec_ptr(pic, REG(A))->slots[B];
+      NEXT(3);
+    }
+    CASE(OP_RSET) {
+      RECORD_CHECK(REG(A), REG(A + 1), B);
+      rec_ptr(pic, REG(A))->slots[B] = REG(A + 2);
+      REG(A) = pic_undef_value(pic);
+      NEXT(3);
+    }
   } VM_LOOP_END
 }
 
+/*
+ * A task is a call running on a budget. Its context lives here rather
+ * than on the C stack, so that it and the continuations made in it
+ * outlast each slice. Between slices the context is not running, so those
+ * continuations are called as ones of an exited context would be.
+ *
+ * The outermost handler of a task escapes to its context with the error
+ * as the result, so that pic_run can raise it again in the caller's.
+ */
+
+struct task {
+  struct context cxt;           /* sp is NULL once it cannot be resumed */
+  int argc;                     /* of the call it stopped before */
+  int failed;
+  pic_value dyn_env;
+};
+
+static void
+task_dtor(pic_state *pic, void *data)
+{
+  pic_free(pic, data);
+}
+
+static void
+task_mark(pic_state *pic, void *data, void (*mark)(pic_state *, pic_value))
+{
+  struct task *t = data;
+
+  if (t->cxt.sp != NULL) {
+    mark(pic, obj_value(pic, t->cxt.sp));
+  }
+  mark(pic, t->dyn_env);
+}
+
+static const pic_data_type task_type = { "task", task_dtor, task_mark };
+
+#if PIC_USE_ERROR
+
+static pic_value
+task_handler(pic_state *pic)
+{
+  struct task *t;
+  pic_value err;
+
+  pic_get_args(pic, "o", &err);
+
+  t = pic_data(pic, pic_closure_ref(pic, 0));
+  t->failed = 1;
+  return pic_callk(pic, pic_closure_ref(pic, 1), 1, err);
+}
+
+static void
+bind_handler(pic_state *pic, pic_value task)
+{
+  struct task *t = pic_data(pic, task);
+  pic_value cont, var;
+
+  t->cxt.prev = pic->cxt;
+  pic->cxt = &t->cxt;
+  cont = pic_make_cont(pic, pic->halt);
+  pic->cxt = t->cxt.prev;
+
+  var = pic_ref(pic, "current-exception-handlers");
+  pic_dynenv_bind(pic, var, pic_cons(pic, pic_lambda(pic, task_handler, 2, task, cont), pic_call(pic, var, 0)));
+}
+
+#endif
+
+bool
+pic_run(pic_state *pic, pic_value task, long fuel, pic_value *result)
+{
+  struct task *t;
+  pic_value thunk, dyn_env = pic->dyn_env;
+  size_t ai = pic_enter(pic);
+
+  pic_protect(pic, dyn_env);
+
+  if (pic->budget != NULL) {
+    pic_error(pic, "pic_run: already running a task", 0);
+  }
+  if (pic_data_p(pic, task, &task_type)) {
+    t = pic_data(pic, task);
+    if (t->cxt.sp == NULL) {
+      pic_error(pic, "pic_run: task cannot be resumed", 0);
+    }
+  } else {
+    TYPE_CHECK(pic, task, proc);
+    thunk = task;
+    t = pic_malloc(pic, sizeof(struct task));
+    t->cxt.sp = NULL;
+    t->failed = 0;
+    t->dyn_env = pic->dyn_env;
+    task = pic_data_value(pic, t, &task_type);
+    CONTEXT_INITK(pic, &t->cxt, thunk, pic->halt, 0, (pic_value *) NULL);
+    t->cxt.reset = 0;
+    t->cxt.id = ++pic->cxt_id;
+    t->cxt.foreign = false;
+    t->argc = 1;
+#if PIC_USE_ERROR
+    bind_handler(pic, task);
+    t->dyn_env = pic->dyn_env;
+    pic_dynenv_reroot(pic, dyn_env);
+#endif
+  }
+
+  t->cxt.pc = MKCALL(&t->cxt, t->argc);
+  t->cxt.fp = NULL;
+  t->cxt.irep = NULL;
+  pic_dynenv_reroot(pic, t->dyn_env);
+  pic->fuel = fuel;
+  pic->budget = &t->cxt;
+  pic_vm(pic, &t->cxt);
+  pic->fuel = -1;
+  pic->budget = NULL;
+  t->dyn_env = pic->dyn_env;
+
+  pic_dynenv_reroot(pic, dyn_env);
+  pic_leave(pic, ai);
+
+  if (t->cxt.fp != NULL) {      /* halted */
+    *result = pic_protect(pic, t->cxt.fp->regs[1]);
+    t->cxt.sp = NULL;
+#if PIC_USE_ERROR
+    if (t->failed) {
+      pic_raise(pic, *result);
+    }
+#endif
+    return true;
+  }
+  t->argc = t->cxt.pc[1];
+  *result = pic_protect(pic, task);
+  return false;
+}
+
 static pic_value
 pic_proc_make_procedure(pic_state *pic)
 {
@@ -802,6 +1103,169 @@ pic_proc_call_with_values(pic_state *pic)
   return pic_invalid_value(pic);
 }
 
+/*
+ * map and for-each over lists, vectors and strings call proc as a tail
+ * call from here, with a continuation that closes over how far the walk
+ * has got and the results so far, and goes on with the next element when
+ * proc returns. proc thus runs in the VM loop of the caller.
+ *
+ * The continuation closes over a frame of [results in reverse or #f,
+ * index, stamp, what remains of each list...], whose static link holds
+ * what stays the same: [proc, k, type, length, vectors or strings...].
+ * A continuation captured in proc can be resumed any number of times, so
+ * a step that returns is copied into a new frame and continuation; unless
+ * no continuation was taken since the frame was made, as its stamp tells,
+ * when nothing else can hold them and both are reused as they are.
+ */
+
+enum { MAP_ACC, MAP_INDEX, MAP_STAMP, MAP_LISTS };
+enum { MAP_PROC, MAP_K, MAP_TYPE, MAP_LEN, MAP_SEQS };
+
+static pic_value
+map_result(pic_state *pic, struct frame *st)
+{
+  pic_value acc = st->regs[MAP_ACC], vec;
+  int len = pic_int(pic, st->regs[MAP_INDEX]), i;
+  char *buf;
+
+  if (pic_false_p(pic, acc)) {
+    return pic_undef_value(pic);
+  }
+  switch (pic_int(pic, st->up->regs[MAP_TYPE])) {
+  case PIC_TYPE_VECTOR:
+    vec = pic_make_vec(pic, len, NULL);
+    for (i = len - 1; i >= 0; --i, acc = pic_cdr(pic, acc)) {
+      pic_vec_set(pic, vec, i, pic_car(pic, acc));
+    }
+    return vec;
+  case PIC_TYPE_STRING:
+    buf = pic_alloca(pic, len);
+    for (i = len - 1; i >= 0; --i, acc = pic_cdr(pic, acc)) {
+      buf[i] = pic_char(pic, pic_car(pic, acc));
+    }
+    return pic_str_value(pic, buf, len);
+  default:
+    return pic_reverse(pic, acc);
+  }
+}
+
+static pic_value map_call(pic_state *);
+
+/* k is the continuation to reuse for st, or NULL */
+static pic_value
+map_next(pic_state *pic, struct frame *st, struct proc *k)
+{
+  struct frame *up = st->up;
+  int type = pic_int(pic, up->regs[MAP_TYPE]), i = pic_int(pic, st->regs[MAP_INDEX]), n, j;
+  pic_value *argv, r;
+
+  if (type == PIC_TYPE_PAIR) {
+    n = st->regc - MAP_LISTS;
+    for (j = 0; j < n; ++j) {
+      if (! pic_pair_p(pic, st->regs[MAP_LISTS + j]))
+        break;
+    }
+  } else {
+    n = up->regc - MAP_SEQS;
+    j = i < pic_int(pic, up->regs[MAP_LEN]) ? n : 0;
+  }
+  if (j < n) {
+    r = map_result(pic, st);
+    CONTEXT_INIT(pic, pic->cxt, up->regs[MAP_K], 1, &r);
+    return pic_invalid_value(pic);
+  }
+
+  if (k == NULL) {
+    k = (struct proc *)pic_obj_alloc(pic, PIC_TYPE_PROC_FUNC);
+    k->u.func = map_call;
+    k->env = st;
+  }
+  CONTEXT_INITK(pic, pic->cxt, up->regs[MAP_PROC], obj_value(pic, k), n, (type == PIC_TYPE_PAIR ? st->regs + MAP_LISTS : up->regs + MAP_SEQS));
+  argv = pic->cxt->sp->regs + 2;
+  for (j = 0; j < n; ++j) {
+    switch (type) {
+    case PIC_TYPE_PAIR:
+      argv[j] = pic_car(pic, argv[j]);
+      break;
+    case PIC_TYPE_VECTOR:
+      argv[j] = pic_vec_ref(pic, argv[j], i);
+      break;
+    case PIC_TYPE_STRING:
+      argv[j] = pic_char_value(pic, pic_str(pic, argv[j], NULL)[i]);
+      break;
+    }
+  }
+  return pic_invalid_value(pic);
+}
+
+static pic_value
+map_call(pic_state *pic)
+{
+  struct frame *env = pic->cxt->fp->up, *st = env;
+  pic_value v = pic->cxt->fp->regs[1];
+  struct proc *k = NULL;
+  int j;
+
+  /* an inhabitant of the continuation side, like receive_call */
+
+  if (! pic_false_p(pic, env->regs[MAP_ACC]) && pic_int(pic, env->up->regs[MAP_TYPE]) == PIC_TYPE_STRING) {
+    TYPE_CHECK(pic, v, char);
+  }
+  if (pic_int(pic, env->regs[MAP_STAMP]) == pic->captures && pic->captures != INT_MAX) {
+    k = proc_ptr(pic, pic->cxt->fp->regs[0]);
+  } else {
+    st = pic_make_frame_unsafe(pic, env->regc);
+    st->up = env->up;
+    pic_protect(pic, obj_value(pic, st));
+    st->regs[MAP_ACC] = env->regs[MAP_ACC];
+    st->regs[MAP_STAMP] = pic_int_value(pic, pic->captures);
+  }
+  st->regs[MAP_INDEX] = pic_int_value(pic, pic_int(pic, env->regs[MAP_INDEX]) + 1);
+  for (j = MAP_LISTS; j < env->regc; ++j) {
+    st->regs[j] = pic_cdr(pic, env->regs[j]);
+  }
+  if (! pic_false_p(pic, st->regs[MAP_ACC])) {
+    st->regs[MAP_ACC] = pic_cons(pic, v, st->regs[MAP_ACC]);
+  }
+  return map_next(pic, st, k);
+}
+
+/*
+ * Maps proc over argc lists, vectors or strings, as type says, and passes
+ * the results as one of the same to the current continuation; or if
+ * collect is false, just calls proc on each element. The caller checks
+ * the types of argv and returns what this does.
+ */
+pic_value
+pic_mapk(pic_state *pic, int type, pic_value proc, int argc, pic_value *argv, bool collect)
+{
+  struct frame *up, *st;
+  int len = INT_MAX, l, j, nlists = type == PIC_TYPE_PAIR ? argc : 0;
+
+  up = pic_make_frame_unsafe(pic, MAP_SEQS + argc - nlists);
+  pic_protect(pic, obj_value(pic, up));
+  up->regs[MAP_PROC] = proc;
+  up->regs[MAP_K] = GET_CONT(pic);
+  up->regs[MAP_TYPE] = pic_int_value(pic, type);
+  for (j = 0; j < argc - nlists; ++j) {
+    l = type == PIC_TYPE_VECTOR ? pic_vec_len(pic, argv[j]) : pic_str_len(pic, argv[j]);
+    len = len < l ? len : l;
+    up->regs[MAP_SEQS + j] = argv[j];
+  }
+  up->regs[MAP_LEN] = pic_int_value(pic, len);
+
+  st = pic_make_frame_unsafe(pic, MAP_LISTS + nlists);
+  st->up = up;
+  pic_protect(pic, obj_value(pic, st));
+  st->regs[MAP_ACC] = collect ? pic_nil_value(pic) : pic_false_value(pic);
+  st->regs[MAP_INDEX] = pic_int_value(pic, 0);
+  st->regs[MAP_STAMP] = pic_int_value(pic, pic->captures);
+  for (j = 0; j < nlists; ++j) {
+    st->regs[MAP_LISTS + j] = argv[j];
+  }
+  return map_next(pic, st, NULL);
+}
+
 void
 pic_init_proc(pic_state *pic)
 {
@@ -810,4 +1274,6 @@ pic_init_proc(pic_state *pic)
   pic_defun(pic, "apply", pic_proc_apply);
   pic_defun(pic, "values", pic_proc_values);
   pic_defun(pic, "call-with-values", pic_proc_call_with_values);
+  pic_register_func(pic, "call-with-values-continuation", receive_call);
+  pic_register_func(pic, "map-continuation", map_call);
 }
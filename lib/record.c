@@ -7,13 +7,37 @@
 #include "object.h"
 
 pic_value
-pic_make_record(pic_state *pic, pic_value type, pic_value datum)
+pic_make_record_type(pic_state *pic, pic_value name, pic_value fields)
+{
+  struct record_type *type;
+  int n;
+
+  n = pic_length(pic, fields);
+
+  type = (struct record_type *)pic_obj_alloc(pic, PIC_TYPE_RECORD_TYPE);
+  type->name = sym_ptr(pic, name);
+  type->fields = fields;
+  type->nfields = n;
+
+  return obj_value(pic, type);
+}
+
+pic_value
+pic_make_record(pic_state *pic, pic_value type, int n, pic_value *slots)
 {
   struct record *rec;
+  struct record_type *t = rectype_ptr(pic, type);
+  int i;
 
-  rec = (struct record *)pic_obj_alloc(pic, PIC_TYPE_RECORD);
-  rec->type = sym_ptr(pic, type);
-  rec->datum = datum;
+  if (n != t->nfields) {
+    pic_error(pic, "wrong number of fields", 2, obj_value(pic, t->name), pic_int_value(pic, n));
+  }
+
+  rec = (struct record *)pic_obj_alloc_sized(pic, offsetof(struct record, slots) + sizeof(pic_value) * n, PIC_TYPE_RECORD);
+  rec->type = t;
+  for (i = 0; i < n; ++i) {
+    rec->slots[i] = slots ? slots[i] : pic_undef_value(pic);
+  }
 
   return obj_value(pic, rec);
 }
@@ -24,20 +48,83 @@ pic_record_type(pic_state *pic, pic_value rec)
   return obj_value(pic, rec_ptr(pic, rec)->type);
 }
 
+int
+pic_record_len(pic_state *pic, pic_value rec)
+{
+  return rec_ptr(pic, rec)->type->nfields;
+}
+
 pic_value
-pic_record_datum(pic_state *pic, pic_value rec)
+pic_record_ref(pic_state *pic, pic_value rec, int k)
 {
-  return rec_ptr(pic, rec)->datum;
+  return rec_ptr(pic, rec)->slots[k];
+}
+
+static struct record *
+get_record(pic_state *pic, pic_value rec, pic_value type, int k)
+{
+  if (! (pic_rec_p(pic, rec) && pic_eq_p(pic, pic_record_type(pic, rec), type))) {
+    pic_error(pic, "record type mismatch", 2, rec, type);
+  }
+  VALID_INDEX(pic, pic_record_len(pic, rec), k);
+  return rec_ptr(pic, rec);
+}
+
+static pic_value
+pic_rec_make_record_type(pic_state *pic)
+{
+  pic_value name, fields;
+
+  pic_get_args(pic, "mo", &name, &fields);
+
+  return pic_make_record_type(pic, name, fields);
+}
+
+static pic_value
+pic_rec_record_type_p(pic_state *pic)
+{
+  pic_value type;
+
+  pic_get_args(pic, "o", &type);
+
+  return pic_bool_value(pic, pic_rectype_p(pic, type));
+}
+
+static pic_value
+pic_rec_record_type_name(pic_state *pic)
+{
+  pic_value type;
+
+  pic_get_args(pic, "o", &type);
+
+  TYPE_CHECK(pic, type, rectype);
+
+  return obj_value(pic, rectype_ptr(pic, type)->name);
+}
+
+static pic_value
+pic_rec_record_type_fields(pic_state *pic)
+{
+  pic_value type;
+
+  pic_get_args(pic, "o", &type);
+
+  TYPE_CHECK(pic, type, rectype);
+
+  return rectype_ptr(pic, type)->fields;
 }
 
 static pic_value
 pic_rec_make_record(pic_state *pic)
 {
-  pic_value type, datum;
+  pic_value type, *argv;
+  int argc;
 
-  pic_get_args(pic, "mo", &type, &datum);
+  pic_get_args(pic, "o*", &type, &argc, &argv);
 
-  return pic_make_record(pic, type, datum);
+  TYPE_CHECK(pic, type, rectype);
+
+  return pic_make_record(pic, type, argc, argv);
 }
 
 static pic_value
@@ -61,20 +148,38 @@ pic_rec_record_type(pic_state *pic)
 }
 
 static pic_value
-pic_rec_record_datum(pic_state *pic)
+pic_rec_record_ref(pic_state *pic)
 {
-  pic_value rec;
+  pic_value rec, type;
+  int k;
 
-  pic_get_args(pic, "r", &rec);
+  pic_get_args(pic, "ooi", &rec, &type, &k);
+
+  return get_record(pic, rec, type, k)->slots[k];
+}
+
+static pic_value
+pic_rec_record_set(pic_state *pic)
+{
+  pic_value rec, type, val;
+  int k;
+
+  pic_get_args(pic, "ooio", &rec, &type, &k, &val);
 
-  return pic_record_datum(pic, rec);
+  get_record(pic, rec, type, k)->slots[k] = val;
+  return pic_undef_value(pic);
 }
 
 void
 pic_init_record(pic_state *pic)
 {
+  pic_defun(pic, "make-record-type", pic_rec_make_record_type);
+  pic_defun(pic, "record-type?", pic_rec_record_type_p);
+  pic_defun(pic, "record-type-name", pic_rec_record_type_name);
+  pic_defun(pic, "record-type-fields", pic_rec_record_type_fields);
   pic_defun(pic, "make-record", pic_rec_make_record);
   pic_defun(pic, "record?", pic_rec_record_p);
   pic_defun(pic, "record-type", pic_rec_record_type);
-  pic_defun(pic, "record-datum", pic_rec_record_datum);
+  pic_defun(pic, "record-ref", pic_rec_record_ref);
+  pic_defun(pic, "record-set!", pic_rec_record_set);
 }
@@ -8,6 +8,8 @@
 #include "object.h"
 #include "state.h"
 
+KHASH_DEFINE(func_names, pic_func_t, pic_value, kh_ptr_hash_func, kh_ptr_hash_equal)
+
 static pic_value pic_state_features(pic_state *);
 
 void
@@ -34,6 +36,7 @@ void pic_init_var(pic_state *);
 void pic_init_write(pic_state *);
 void pic_init_read(pic_state *);
 void pic_init_dict(pic_state *);
+void pic_init_table(pic_state *);
 void pic_init_record(pic_state *);
 void pic_init_attr(pic_state *);
 void pic_init_file(pic_state *);
@@ -48,7 +51,6 @@ pic_init_core(pic_state *pic)
   size_t ai = pic_enter(pic);
 
   pic_define(pic, "__picrin_features__", pic_nil_value(pic));
-  pic_define(pic, "__picrin_dynenv__", pic_list(pic, 1, pic_make_attr(pic)));
 
   pic_init_bool(pic); DONE;
   pic_init_pair(pic); DONE;
@@ -61,6 +63,7 @@ pic_init_core(pic_state *pic)
   pic_init_str(pic); DONE;
   pic_init_var(pic); DONE;
   pic_init_dict(pic); DONE;
+  pic_init_table(pic); DONE;
   pic_init_record(pic); DONE;
   pic_init_attr(pic); DONE;
   pic_init_state(pic); DONE;
@@ -115,9 +118,16 @@ pic_open(pic_allocf allocf, void *userdata, pic_panicf panicf)
   pic->default_cxt.sp = NULL;
   pic->default_cxt.irep = NULL;
   pic->default_cxt.prev = NULL;
-  pic->default_cxt.conts = pic_nil_value(pic);
+  pic->default_cxt.foreign = false;
+  pic->default_cxt.id = 0;
+  pic->cxt_id = 0;
+  pic->captures = 0;
   pic->cxt = &pic->default_cxt;
 
+  /* budget */
+  pic->fuel = -1;
+  pic->budget = NULL;
+
   /* arena */
   pic->arena = allocf(userdata, NULL, PIC_ARENA_SIZE * sizeof(struct object *));
   pic->arena_size = PIC_ARENA_SIZE;
@@ -133,7 +143,12 @@ pic_open(pic_allocf allocf, void *userdata, pic_panicf panicf)
   /* gc */
   pic->gc_head.next = (struct object *) &pic->gc_head;
   pic->gc_attrs = NULL;
+  pic->gc_slices = NULL;
   pic->gc_count = 0;
+  pic->gc_live = 0;
+  pic->gc_frames = NULL;
+  pic->gc_frames_len = pic->gc_frames_size = 0;
+  pic->checkpoint = NULL;
 
   /* symbol table */
   kh_init(oblist, &pic->oblist);
@@ -141,6 +156,17 @@ pic_open(pic_allocf allocf, void *userdata, pic_panicf panicf)
   /* global variables */
   pic->globals = pic_make_dict(pic);
 
+  /* C functions */
+  pic->funcs = pic_make_dict(pic);
+  kh_init(func_names, &pic->func_names);
+
+  /* record types written by pic_serialize */
+  pic->rectypes = pic_make_attr(pic);
+  pic->rectype_uid = 0;
+
+  /* dynamic environment */
+  pic->dyn_env = pic_cons(pic, pic_cons(pic, pic_false_value(pic), pic_false_value(pic)), pic_nil_value(pic));
+
   /* top continuation */
   {
     static const code_t halt_code[] = { 0x00 };
@@ -187,6 +213,10 @@ pic_close(pic_state *pic)
   pic->ai = 0;
   pic->halt = pic_invalid_value(pic);
   pic->globals = pic_invalid_value(pic);
+  pic->funcs = pic_invalid_value(pic);
+  pic->rectypes = pic_invalid_value(pic);
+  pic->dyn_env = pic_invalid_value(pic);
+  pic_drop_checkpoint(pic);
 
   assert(pic->cxt->ai == 0);
   assert(pic->cxt->pc == NULL);
@@ -202,9 +232,11 @@ pic_close(pic_state *pic)
 
   /* free global stacks */
   kh_destroy(oblist, &pic->oblist);
+  kh_destroy(func_names, &pic->func_names);
 
   /* free GC arena */
   allocf(pic->userdata, pic->arena, 0);
+  allocf(pic->userdata, pic->gc_frames, 0);
   allocf(pic->userdata, pic, 0);
 }
 
@@ -268,7 +300,54 @@ pic_define(pic_state *pic, const char *name, pic_value val)
 void
 pic_defun(pic_state *pic, const char *name, pic_func_t f)
 {
-  pic_define(pic, name, pic_lambda(pic, f, 0));
+  pic_register_func(pic, name, f);
+  pic_define(pic, name, pic_dict_ref(pic, pic->funcs, pic_intern_cstr(pic, name)));
+}
+
+/*
+ * Names a C function so that procedures made from it can be saved in an
+ * image (see pic_save_image) and found again by the state loading it.
+ * pic_defun does this for the functions it defines.
+ */
+void
+pic_register_func(pic_state *pic, const char *name, pic_func_t f)
+{
+  khash_t(func_names) *h = &pic->func_names;
+  pic_value sym = pic_intern_cstr(pic, name);
+  int it, ret;
+
+  if (pic_dict_has(pic, pic->funcs, sym)) {
+    /* the function registered before under this name loses it */
+    it = kh_get(func_names, h, proc_ptr(pic, pic_dict_ref(pic, pic->funcs, sym))->u.func);
+    if (it != kh_end(h) && pic_eq_p(pic, kh_val(h, it), sym)) {
+      kh_del(func_names, h, it);
+    }
+  }
+  pic_dict_set(pic, pic->funcs, sym, pic_lambda(pic, f, 0));
+  it = kh_put(func_names, h, f, &ret);
+  kh_val(h, it) = sym;
+}
+
+pic_value
+pic_func_name(pic_state *pic, pic_func_t f)
+{
+  khash_t(func_names) *h = &pic->func_names;
+  int it;
+
+  it = kh_get(func_names, h, f);
+  if (it == kh_end(h)) {
+    return pic_false_value(pic);
+  }
+  return kh_val(h, it);
+}
+
+pic_func_t
+pic_func_ref(pic_state *pic, pic_value name)
+{
+  if (! pic_dict_has(pic, pic->funcs, name)) {
+    return NULL;
+  }
+  return proc_ptr(pic, pic_dict_ref(pic, pic->funcs, name))->u.func;
 }
 
 void
@@ -13,6 +13,7 @@ extern "C" {
 #include "object.h"
 
 KHASH_DECLARE(oblist, struct string *, struct symbol *)
+KHASH_DECLARE(func_names, pic_func_t, pic_value)
 
 struct context {
   PIC_JMPBUF jmp;
@@ -25,8 +26,12 @@ struct context {
   struct irep *irep;
 
   code_t tmpcode[2];
-  pic_value conts;
   bool reset;
+  bool foreign;                 /* running a continuation of a context that has exited */
+  unsigned long id;             /* tells apart contexts at the same address */
+
+  /* try only: environment to restore on exit, kept alive by the escape */
+  pic_value dyn_env;
 
   struct context *prev;
 };
@@ -38,8 +43,18 @@ struct pic_state {
   struct context *cxt, default_cxt;
   size_t ai;
 
+  unsigned long cxt_id;         /* last context id handed out */
+  int captures;                 /* continuations taken, up to INT_MAX; see pic_mapk */
+  long fuel;                    /* calls left before budget suspends, or -1 */
+  struct context *budget;       /* context of the task pic_run is running */
+
   khash_t(oblist) oblist;       /* string to symbol */
   pic_value globals;            /* dict */
+  pic_value funcs;              /* dict: name -> C procedure, see pic_register_func */
+  khash_t(func_names) func_names; /* the other way around, for pic_func_name */
+  pic_value rectypes;           /* attr: record type -> uid it was serialized with */
+  int rectype_uid;              /* last uid handed out */
+  pic_value dyn_env;            /* root of the binding tree, see var.c */
 
   struct object **arena;
   size_t arena_size;
@@ -47,16 +62,31 @@ struct pic_state {
   bool gc_enable;
   struct object gc_head;
   struct attr *gc_attrs;
+  struct rope_slice *gc_slices;
   size_t gc_count;
+  size_t gc_live;               /* bytes of objects alive after the last GC */
+  struct frame **gc_frames;     /* frames whose registers are yet to be marked */
+  size_t gc_frames_len, gc_frames_size;
+  struct checkpoint *checkpoint; /* see pic_checkpoint */
 
   pic_value halt;               /* top continuation */
 
   pic_panicf panicf;
 };
 
+pic_value pic_func_name(pic_state *pic, pic_func_t f);
+pic_func_t pic_func_ref(pic_state *pic, pic_value name);
+
 pic_value pic_global_ref(pic_state *pic, pic_value uid);
 void pic_global_set(pic_state *pic, pic_value uid, pic_value value);
 
+void pic_dynenv_bind(pic_state *pic, pic_value var, pic_value val);
+void pic_dynenv_reroot(pic_state *pic, pic_value env);
+
+void pic_drop_checkpoint(pic_state *pic);
+
+#define CAPTURED(pic) ((pic)->captures += (pic)->captures < INT_MAX)
+
 #define MKCALL(cxt,argc)                                                \
   ((argc) < 256                                                         \
    ? ((cxt)->tmpcode[0] = OP_CALL, (cxt)->tmpcode[1] = (argc), (cxt)->tmpcode) \
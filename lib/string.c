@@ -7,17 +7,12 @@
 #include "object.h"
 
 pic_value
-pic_str_value(pic_state *pic, const char *str, int len)
+pic_make_str(pic_state *pic, char *buf, int len)
 {
-  char *buf;
   struct rope_leaf *leaf;
   struct string *s;
 
-  assert(str != NULL);
-
-  buf = pic_malloc(pic, len + 1);
-  buf[len] = 0;
-  memcpy(buf, str, len);
+  assert(buf[len] == '\0');
 
   leaf = (struct rope_leaf *) pic_obj_alloc(pic, PIC_TYPE_ROPE_LEAF);
   leaf->len = len;
@@ -28,6 +23,22 @@ pic_str_value(pic_state *pic, const char *str, int len)
   return obj_value(pic, s);
 }
 
+pic_value
+pic_str_value(pic_state *pic, const char *str, int len)
+{
+  char *buf;
+
+  assert(str != NULL || len == 0); /* pic_alloca(pic, 0) may give NULL */
+
+  buf = pic_malloc(pic, len + 1);
+  buf[len] = 0;
+  if (len > 0) {
+    memcpy(buf, str, len);
+  }
+
+  return pic_make_str(pic, buf, len);
+}
+
 pic_value
 pic_cstr_value(pic_state *pic, const char *cstr)
 {
@@ -46,64 +57,232 @@ pic_strf_value(pic_state *pic, const char *fmt, ...)
   return str;
 }
 
+/* writes the decimal digits of i backwards from the end of buf */
+static char *
+fmt_int(int i, char *end)
+{
+  static const char pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+  unsigned long u = i < 0 ? 0UL - (unsigned long) i : (unsigned long) i;
+  char *p = end;
+
+  while (u >= 100) {
+    const char *d = pairs + (u % 100) * 2;
+    u /= 100;
+    *--p = d[1];
+    *--p = d[0];
+  }
+  if (u >= 10) {
+    *--p = pairs[u * 2 + 1];
+    *--p = pairs[u * 2];
+  } else {
+    *--p = '0' + (char) u;
+  }
+  if (i < 0) {
+    *--p = '-';
+  }
+  return p;
+}
+
 pic_value
 pic_vstrf_value(pic_state *pic, const char *fmt, va_list ap)
 {
-  pic_value str, str2;
+  pic_strbuf sb;
   const char *p;
+  pic_value str;
+
+  pic_strbuf_init(pic, &sb);
 
-  for (p = fmt; *p; p++) {
-    if (*p == '%')
+  while (1) {
+    for (p = fmt; *p; p++) {
+      if (*p == '%')
+        break;
+    }
+    pic_strbuf_write(pic, &sb, fmt, p - fmt);
+    if (*p == '\0') {
       break;
-  }
-  str = pic_str_value(pic, fmt, p - fmt);
-  if (*p == 0) {
-    return str;
-  }
-  p++;                          /* skip '%' */
-  switch (*p++) {
-  case '\0':
-    return pic_str_value(pic, fmt, p - fmt - 1);
-  case 'd':
-  case 'i': {
-    int i = va_arg(ap, int);
-    str2 = pic_funcall(pic, "number->string", 1, pic_int_value(pic, i));
-    break;
-  }
-  case 'f': {
-    double f = va_arg(ap, double);
-    str2 = pic_funcall(pic, "number->string", 1, pic_float_value(pic, f));
-    break;
-  }
-  case 'c': {
-    char c = (char) va_arg(ap, int);
-    str2 = pic_str_value(pic, &c, 1);
-    break;
-  }
-  case 's': {
-    char *sval = va_arg(ap, char*);
-    str2 = pic_cstr_value(pic, sval);
-    break;
-  }
-  case 'p': {
-    static const char digits[] = "0123456789abcdef";
+    }
+    p++;                        /* skip '%' */
+    switch (*p) {
+    case '\0':
+      pic_strbuf_putc(pic, &sb, '%');
+      fmt = p;
+      continue;
+    case 'd':
+    case 'i': {
+      char buf[sizeof(int) * CHAR_BIT / 3 + 3], *end = buf + sizeof buf, *q;
+      q = fmt_int(va_arg(ap, int), end);
+      pic_strbuf_write(pic, &sb, q, end - q);
+      break;
+    }
+    case 'f': {
+      char buf[64];
+      pic_dtoa(va_arg(ap, double), buf);
+      pic_strbuf_write(pic, &sb, buf, strlen(buf));
+      break;
+    }
+    case 'c': {
+      char c = (char) va_arg(ap, int);
+      pic_strbuf_putc(pic, &sb, c);
+      break;
+    }
+    case 's': {
+      char *sval = va_arg(ap, char*);
+      pic_strbuf_write(pic, &sb, sval, strlen(sval));
+      break;
+    }
+    case 'p': {
+      static const char digits[] = "0123456789abcdef";
 #define MAXLEN (sizeof(long) * CHAR_BIT / 4)
-    unsigned long vp = (unsigned long) va_arg(ap, void*);
-    char buf[2 + MAXLEN + 1] = "0x", *p = buf + 2;
-    size_t i;
-    for (i = 0; i < MAXLEN; ++i) {
-      p[MAXLEN - i - 2] = digits[vp % 16];
-      vp /= 16;
+      unsigned long vp = (unsigned long) va_arg(ap, void*);
+      char buf[2 + MAXLEN] = "0x";
+      size_t i;
+      for (i = 0; i < MAXLEN; ++i) {
+        buf[2 + MAXLEN - i - 1] = digits[vp % 16];
+        vp /= 16;
+      }
+      pic_strbuf_write(pic, &sb, buf, sizeof buf);
+      break;
     }
-    p[i] = '\0';
-    str2 = pic_cstr_value(pic, buf);
-    break;
+    case '%':
+      pic_strbuf_putc(pic, &sb, '%');
+      break;
+    default:
+      pic_strbuf_write(pic, &sb, p - 1, 2);
+      break;
+    }
+    fmt = p + 1;
+  }
+
+  /* messages longer than a chunk are flattened once here */
+  str = pic_strbuf_value(pic, &sb);
+  pic_str(pic, str, NULL);
+  return str;
+}
+
+/* string builder: characters are appended to a chunk owned by a
+   rope leaf, and full chunks are concatenated without copying */
+
+#define STRBUF_CHUNK_MIN 64
+#define STRBUF_CHUNK_MAX (1024 * 1024)
+
+void
+pic_strbuf_init(pic_state *pic, pic_strbuf *sb)
+{
+  sb->str = pic_invalid_value(pic);
+  sb->chunk = pic_invalid_value(pic);
+  sb->buf = NULL;
+  sb->len = sb->capa = 0;
+}
+
+static void
+strbuf_push(pic_state *pic, pic_strbuf *sb, pic_value str)
+{
+  if (pic_invalid_p(pic, sb->str)) {
+    sb->str = str;
+  } else {
+    sb->str = pic_str_cat(pic, sb->str, str);
+  }
+}
+
+static void
+strbuf_grow(pic_state *pic, pic_strbuf *sb)
+{
+  int capa = 0;
+  char *buf;
+
+  if (sb->len > 0) {
+    strbuf_push(pic, sb, sb->chunk);
   }
-  case '%':
-    str2 = pic_str_value(pic, &p[-1], 1);
-    break;
+  if (! pic_invalid_p(pic, sb->str)) {
+    capa = pic_str_len(pic, sb->str);
   }
-  return pic_str_cat(pic, str, pic_str_cat(pic, str2, pic_vstrf_value(pic, p, ap)));
+  /* chunks grow with the string to keep the rope shallow */
+  if (capa < STRBUF_CHUNK_MIN) {
+    capa = STRBUF_CHUNK_MIN;
+  }
+  if (capa > STRBUF_CHUNK_MAX) {
+    capa = STRBUF_CHUNK_MAX;
+  }
+
+  buf = pic_malloc(pic, capa + 1);
+  buf[capa] = '\0';
+  sb->chunk = pic_make_str(pic, buf, capa);
+  sb->buf = buf;
+  sb->len = 0;
+  sb->capa = capa;
+}
+
+void
+pic_strbuf_write(pic_state *pic, pic_strbuf *sb, const char *str, int len)
+{
+  int n;
+
+  while (len > 0) {
+    if (sb->len == sb->capa) {
+      strbuf_grow(pic, sb);
+    }
+    n = sb->capa - sb->len;
+    if (n > len) {
+      n = len;
+    }
+    memcpy(sb->buf + sb->len, str, n);
+    sb->len += n;
+    str += n;
+    len -= n;
+  }
+}
+
+void
+pic_strbuf_putc(pic_state *pic, pic_strbuf *sb, char c)
+{
+  if (sb->len == sb->capa) {
+    strbuf_grow(pic, sb);
+  }
+  sb->buf[sb->len++] = c;
+}
+
+/* trims the current chunk into a leaf; the next write starts a new one */
+pic_value
+pic_strbuf_value(pic_state *pic, pic_strbuf *sb)
+{
+  if (sb->len > 0) {
+    str_ptr(pic, sb->chunk)->rope->len = sb->len;
+    sb->buf[sb->len] = '\0';
+    strbuf_push(pic, sb, sb->chunk);
+    sb->chunk = pic_invalid_value(pic);
+    sb->buf = NULL;
+    sb->len = sb->capa = 0;
+  }
+  return pic_strbuf_snapshot(pic, sb);
+}
+
+/* the result shares the current chunk, which stays open for writing */
+pic_value
+pic_strbuf_snapshot(pic_state *pic, pic_strbuf *sb)
+{
+  pic_value tail;
+
+  if (sb->len == 0) {
+    if (pic_invalid_p(pic, sb->str)) {
+      return pic_lit_value(pic, "");
+    }
+    return pic_str_sub(pic, sb->str, 0, pic_str_len(pic, sb->str));
+  }
+  tail = pic_str_sub(pic, sb->chunk, 0, sb->len);
+  if (pic_invalid_p(pic, sb->str)) {
+    return tail;
+  }
+  return pic_str_cat(pic, sb->str, tail);
 }
 
 int
@@ -129,6 +308,28 @@ pic_str_cat(pic_state *pic, pic_value a, pic_value b)
   return obj_value(pic, s);
 }
 
+static pic_value
+make_str(pic_state *pic, struct rope *rope)
+{
+  struct string *s;
+
+  s = (struct string *) pic_obj_alloc(pic, PIC_TYPE_STRING);
+  s->rope = rope;
+  return obj_value(pic, s);
+}
+
+static pic_value
+make_slice(pic_state *pic, struct rope_leaf *base, const char *str, int len)
+{
+  struct rope_slice *slice;
+
+  slice = (struct rope_slice *) pic_obj_alloc(pic, PIC_TYPE_ROPE_SLICE);
+  slice->len = len;
+  slice->str = str;
+  slice->base = base;
+  return make_str(pic, (struct rope *) slice);
+}
+
 static pic_value
 str_sub(pic_state *pic, struct rope *rope, int i, int j)
 {
@@ -136,11 +337,18 @@ str_sub(pic_state *pic, struct rope *rope, int i, int j)
   pic_value s1, s2;
 
   if (i == 0 && rope->len == j) {
-    return obj_value(pic, rope);
+    return make_str(pic, rope);
   }
 
-  if (obj_type(rope) == PIC_TYPE_ROPE_LEAF) {
-    return pic_str_value(pic, ((struct rope_leaf *) rope)->str + i, j - i);
+  switch (obj_type(rope)) {
+  case PIC_TYPE_ROPE_LEAF: {
+    struct rope_leaf *leaf = (struct rope_leaf *) rope;
+    return make_slice(pic, leaf, leaf->str + i, j - i);
+  }
+  case PIC_TYPE_ROPE_SLICE: {
+    struct rope_slice *slice = (struct rope_slice *) rope;
+    return make_slice(pic, slice->base, slice->str + i, j - i);
+  }
   }
 
   lweight = ((struct rope_node *) rope)->s1->len;
@@ -163,13 +371,26 @@ pic_str_sub(pic_state *pic, pic_value str, int s, int e)
   return str_sub(pic, str_ptr(pic, str)->rope, s, e);
 }
 
+/* like pic_str but the result is not necessarily NUL-terminated */
+static const char *
+str_peek(pic_state *pic, pic_value str, int *len)
+{
+  struct rope *rope = str_ptr(pic, str)->rope;
+
+  if (obj_type(rope) == PIC_TYPE_ROPE_SLICE) {
+    *len = rope->len;
+    return ((struct rope_slice *) rope)->str;
+  }
+  return pic_str(pic, str, len);
+}
+
 int
 pic_str_hash(pic_state *pic, pic_value str)
 {
   int len, h = 0;
   const char *s;
 
-  s = pic_str(pic, str, &len);
+  s = str_peek(pic, str, &len);
   while (len-- > 0) {
     h = (h << 5) - h + *s++;
   }
@@ -182,8 +403,8 @@ pic_str_cmp(pic_state *pic, pic_value str1, pic_value str2)
   int len1, len2, r;
   const char *buf1, *buf2;
 
-  buf1 = pic_str(pic, str1, &len1);
-  buf2 = pic_str(pic, str2, &len2);
+  buf1 = str_peek(pic, str1, &len1);
+  buf2 = str_peek(pic, str2, &len2);
 
   if (len1 == len2) {
     return memcmp(buf1, buf2, len1);
@@ -200,6 +421,8 @@ str_cstr(pic_state *pic, struct rope *rope, char *buf)
 {
   if (obj_type(rope) == PIC_TYPE_ROPE_LEAF) {
     memcpy(buf, ((struct rope_leaf *) rope)->str, rope->len);
+  } else if (obj_type(rope) == PIC_TYPE_ROPE_SLICE) {
+    memcpy(buf, ((struct rope_slice *) rope)->str, rope->len);
   } else {
     struct rope_node *r = (struct rope_node *) rope;
     str_cstr(pic, r->s1, buf);
@@ -315,13 +538,16 @@ static pic_value
 pic_str_string_ref(pic_state *pic)
 {
   pic_value str;
-  int k;
+  int k, len;
+  const char *buf;
 
   pic_get_args(pic, "si", &str, &k);
 
-  VALID_INDEX(pic, pic_str_len(pic, str), k);
+  buf = str_peek(pic, str, &len);
+
+  VALID_INDEX(pic, len, k);
 
-  return pic_char_value(pic, pic_str(pic, str, 0)[k]);
+  return pic_char_value(pic, buf[k]);
 }
 
 static pic_value
@@ -481,9 +707,8 @@ pic_str_string_append(pic_state *pic)
 static pic_value
 pic_str_string_map(pic_state *pic)
 {
-  pic_value proc, *argv, vals, val;
-  int argc, i, len, j;
-  char *buf;
+  pic_value proc, *argv;
+  int argc, i;
 
   pic_get_args(pic, "l*", &proc, &argc, &argv);
 
@@ -491,36 +716,18 @@ pic_str_string_map(pic_state *pic)
     pic_error(pic, "string-map: one or more strings expected, but got zero", 0);
   }
 
-  len = INT_MAX;
   for (i = 0; i < argc; ++i) {
-    int l;
     TYPE_CHECK(pic, argv[i], str);
-    l = pic_str_len(pic, argv[i]);
-    len = len < l ? len : l;
   }
 
-  buf = pic_alloca(pic, len);
-
-  for (i = 0; i < len; ++i) {
-    vals = pic_nil_value(pic);
-    for (j = 0; j < argc; ++j) {
-      pic_push(pic, pic_char_value(pic, pic_str(pic, argv[j], 0)[i]), vals);
-    }
-    vals = pic_reverse(pic, vals);
-    val = pic_funcall(pic, "apply", 2, proc, vals);
-
-    TYPE_CHECK(pic, val, char);
-
-    buf[i] = pic_char(pic, val);
-  }
-  return pic_str_value(pic, buf, len);
+  return pic_mapk(pic, PIC_TYPE_STRING, proc, argc, argv, true);
 }
 
 static pic_value
 pic_str_string_for_each(pic_state *pic)
 {
-  pic_value proc, *argv, vals;
-  int argc, i, len, j;
+  pic_value proc, *argv;
+  int argc, i;
 
   pic_get_args(pic, "l*", &proc, &argc, &argv);
 
@@ -528,23 +735,11 @@ pic_str_string_for_each(pic_state *pic)
     pic_error(pic, "string-map: one or more strings expected, but got zero", 0);
   }
 
-  len = INT_MAX;
   for (i = 0; i < argc; ++i) {
-    int l;
     TYPE_CHECK(pic, argv[i], str);
-    l = pic_str_len(pic, argv[i]);
-    len = len < l ? len : l;
   }
 
-  for (i = 0; i < len; ++i) {
-    vals = pic_nil_value(pic);
-    for (j = 0; j < argc; ++j) {
-      pic_push(pic, pic_char_value(pic, pic_str(pic, argv[j], 0)[i]), vals);
-    }
-    vals = pic_reverse(pic, vals);
-    pic_funcall(pic, "apply", 2, proc, vals);
-  }
-  return pic_undef_value(pic);
+  return pic_mapk(pic, PIC_TYPE_STRING, proc, argc, argv, false);
 }
 
 static pic_value
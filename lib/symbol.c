@@ -37,6 +37,30 @@ pic_intern(pic_state *pic, pic_value str)
   return obj_value(pic, sym);
 }
 
+pic_value
+pic_intern_str(pic_state *pic, const char *str, int len)
+{
+  khash_t(oblist) *h = &pic->oblist;
+  struct rope_slice slice;
+  struct string key;
+  int it;
+
+  /* look the name up through a transient string on the stack so that
+     interning an existing symbol does not allocate */
+  slice.tt = PIC_TYPE_ROPE_SLICE;
+  slice.len = len;
+  slice.str = str;
+  key.tt = PIC_TYPE_STRING;
+  key.rope = (struct rope *) &slice;
+
+  it = kh_get(oblist, h, &key);
+  if (it != kh_end(h)) {
+    pic_protect(pic, obj_value(pic, kh_val(h, it)));
+    return obj_value(pic, kh_val(h, it));
+  }
+  return pic_intern(pic, pic_str_value(pic, str, len));
+}
+
 pic_value
 pic_sym_name(pic_state *pic, pic_value sym)
 {
@@ -0,0 +1,810 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include <picrin.h>
+#include "value.h"
+#include "object.h"
+
+/*
+ * Open addressing with linear probing. Each bucket caches the full hash of
+ * its key; hash values 0 and 1 are reserved for empty and deleted buckets.
+ * Growing does not rehash in one go: the previous bucket array is kept in
+ * t->old and a few of its buckets are moved into t->b on every mutation, so
+ * no single insertion pays for the whole table.
+ */
+
+#define EMPTY 0
+#define DELETED 1
+
+#define TABLE_CUSTOM (PIC_TABLE_STRING + 1)
+#define TABLE_MIN_CAPA 8
+#define TABLE_MIGRATE_STEP 8
+#define HASH_BUDGET 16          /* components of a datum looked at by equal hash */
+
+static unsigned
+hash_bytes(unsigned h, const unsigned char *p, int len)
+{
+  int i;
+
+  for (i = 0; i < len; ++i) {
+    h = (h ^ p[i]) * 16777619u;
+  }
+  return h;
+}
+
+static unsigned
+hash_eq(pic_state *pic, pic_value v)
+{
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_INT:
+    return (unsigned) pic_int(pic, v);
+  case PIC_TYPE_CHAR:
+    return (unsigned char) pic_char(pic, v);
+  case PIC_TYPE_FLOAT: {
+    double f = pic_float(pic, v);
+    return hash_bytes(2166136261u, (unsigned char *) &f, sizeof f);
+  }
+  default:
+    if (pic_obj_p(pic, v)) {
+      return (unsigned) ((unsigned long) pic_ptr(pic, v) >> 4);
+    }
+    return pic_type(pic, v);
+  }
+}
+
+static unsigned
+hash_equal(pic_state *pic, pic_value v, int *budget)
+{
+  unsigned h;
+  int i, len;
+
+  if ((*budget)-- <= 0) {
+    return 0;
+  }
+
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_STRING:
+    return pic_str_hash(pic, v);
+  case PIC_TYPE_BLOB:
+    return hash_bytes(2166136261u, blob_ptr(pic, v)->data, blob_ptr(pic, v)->len);
+  case PIC_TYPE_PAIR:
+    h = hash_equal(pic, pic_car(pic, v), budget);
+    return h * 31 + hash_equal(pic, pic_cdr(pic, v), budget);
+  case PIC_TYPE_VECTOR:
+    len = pic_vec_len(pic, v);
+    h = len;
+    for (i = 0; i < len && *budget > 0; ++i) {
+      h = h * 31 + hash_equal(pic, pic_vec_ref(pic, v, i), budget);
+    }
+    return h;
+  case PIC_TYPE_RECORD:
+    len = pic_record_len(pic, v);
+    h = hash_eq(pic, pic_record_type(pic, v));
+    for (i = 0; i < len && *budget > 0; ++i) {
+      h = h * 31 + hash_equal(pic, pic_record_ref(pic, v, i), budget);
+    }
+    return h;
+  case PIC_TYPE_DICT:
+    return pic_dict_size(pic, v);
+  case PIC_TYPE_DATA:
+    return (unsigned) ((unsigned long) data_ptr(pic, v)->data >> 4);
+  default:
+    return hash_eq(pic, v);
+  }
+}
+
+static unsigned
+hash_mix(unsigned h)
+{
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+static unsigned
+hash_key(pic_state *pic, struct table *t, pic_value key)
+{
+  unsigned h;
+  int budget = HASH_BUDGET;
+
+  switch (t->kind) {
+  case PIC_TABLE_EQ:
+  case PIC_TABLE_EQV:
+    h = hash_eq(pic, key);
+    break;
+  case PIC_TABLE_STRING:
+    TYPE_CHECK(pic, key, str);
+    h = pic_str_hash(pic, key);
+    break;
+  default:
+    if (pic_false_p(pic, t->hash)) {
+      h = hash_equal(pic, key, &budget);
+    } else {
+      pic_value r = pic_call(pic, t->hash, 1, key);
+      TYPE_CHECK(pic, r, int);
+      h = pic_int(pic, r);
+    }
+    break;
+  }
+  h = hash_mix(h);
+  return h > DELETED ? h : h + 2;
+}
+
+static bool
+key_equal(pic_state *pic, struct table *t, pic_value a, pic_value b)
+{
+  switch (t->kind) {
+  case PIC_TABLE_EQ:
+    return pic_eq_p(pic, a, b);
+  case PIC_TABLE_EQV:
+    return pic_eqv_p(pic, a, b);
+  case PIC_TABLE_EQUAL:
+    return pic_equal_p(pic, a, b);
+  case PIC_TABLE_STRING:
+    return pic_str_cmp(pic, a, b) == 0;
+  default:
+    return ! pic_false_p(pic, pic_call(pic, t->equal, 2, a, b));
+  }
+}
+
+static int
+probe(pic_state *pic, struct table *t, struct bucket *b, int capa, pic_value key, unsigned h)
+{
+  int i, mask = capa - 1;
+
+  if (capa == 0) {
+    return -1;
+  }
+  for (i = h & mask; b[i].hash != EMPTY; i = (i + 1) & mask) {
+    if (b[i].hash == h && key_equal(pic, t, b[i].key, key)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* the key must not be in the table yet */
+static void
+insert(struct table *t, unsigned h, pic_value key, pic_value val)
+{
+  int i, mask = t->capa - 1;
+
+  for (i = h & mask; t->b[i].hash > DELETED; i = (i + 1) & mask)
+    ;
+  if (t->b[i].hash == EMPTY) {
+    t->used++;
+  }
+  t->b[i].hash = h;
+  t->b[i].key = key;
+  t->b[i].val = val;
+}
+
+static void
+migrate(pic_state *pic, struct table *t, int n)
+{
+  struct bucket *e;
+
+  while (t->old && n-- > 0) {
+    e = &t->old[t->migrated++];
+    if (e->hash > DELETED) {
+      insert(t, e->hash, e->key, e->val);
+      e->hash = DELETED;
+    }
+    if (t->migrated == t->old_capa) {
+      pic_free(pic, t->old);
+      t->old = NULL;
+      t->old_capa = t->migrated = 0;
+    }
+  }
+}
+
+static int
+table_capa(int size)
+{
+  int capa = TABLE_MIN_CAPA;
+
+  while (capa / 2 <= size) {
+    capa *= 2;
+  }
+  return capa;
+}
+
+/* moves every entry into a fresh array of the given capacity */
+static void
+rehash(pic_state *pic, struct table *t, int capa)
+{
+  struct bucket *b = t->b, *old = t->old;
+  int i, n = t->capa, old_capa = t->old_capa;
+
+  t->b = pic_calloc(pic, capa, sizeof(struct bucket));
+  t->capa = capa;
+  t->used = 0;
+  t->old = NULL;
+  t->old_capa = t->migrated = 0;
+
+  for (i = 0; i < n; ++i) {
+    if (b[i].hash > DELETED) {
+      insert(t, b[i].hash, b[i].key, b[i].val);
+    }
+  }
+  for (i = 0; i < old_capa; ++i) {
+    if (old[i].hash > DELETED) {
+      insert(t, old[i].hash, old[i].key, old[i].val);
+    }
+  }
+  pic_free(pic, b);
+  pic_free(pic, old);
+}
+
+static void
+grow(pic_state *pic, struct table *t)
+{
+  int capa = table_capa(t->size);
+
+  if (t->capa == 0 || t->old) {
+    /* previous migration still pending; finish everything now */
+    rehash(pic, t, capa);
+    return;
+  }
+  t->old = t->b;
+  t->old_capa = t->capa;
+  t->migrated = 0;
+  t->b = pic_calloc(pic, capa, sizeof(struct bucket));
+  t->capa = capa;
+  t->used = 0;
+}
+
+static struct bucket *
+lookup(pic_state *pic, struct table *t, pic_value key)
+{
+  unsigned h = hash_key(pic, t, key);
+  int i;
+
+  if ((i = probe(pic, t, t->b, t->capa, key, h)) >= 0) {
+    return &t->b[i];
+  }
+  if ((i = probe(pic, t, t->old, t->old_capa, key, h)) >= 0) {
+    return &t->old[i];
+  }
+  return NULL;
+}
+
+static pic_value
+make_table(pic_state *pic, int kind, pic_value equal, pic_value hash)
+{
+  struct table *t;
+
+  t = (struct table *)pic_obj_alloc(pic, PIC_TYPE_TABLE);
+  t->kind = kind;
+  t->equal = equal;
+  t->hash = hash;
+  t->b = t->old = NULL;
+  t->capa = t->used = t->size = 0;
+  t->old_capa = t->migrated = 0;
+  return obj_value(pic, t);
+}
+
+pic_value
+pic_make_table(pic_state *pic, int kind)
+{
+  return make_table(pic, kind, pic_false_value(pic), pic_false_value(pic));
+}
+
+pic_value
+pic_table_ref(pic_state *pic, pic_value table, pic_value key)
+{
+  struct bucket *e;
+
+  e = lookup(pic, table_ptr(pic, table), key);
+  if (e == NULL) {
+    pic_error(pic, "element not found for given key", 1, key);
+  }
+  return e->val;
+}
+
+void
+pic_table_set(pic_state *pic, pic_value table, pic_value key, pic_value val)
+{
+  struct table *t = table_ptr(pic, table);
+  unsigned h;
+  int i;
+
+  migrate(pic, t, TABLE_MIGRATE_STEP);
+
+  h = hash_key(pic, t, key);
+  if ((i = probe(pic, t, t->b, t->capa, key, h)) >= 0) {
+    t->b[i].val = val;
+    return;
+  }
+  if ((i = probe(pic, t, t->old, t->old_capa, key, h)) >= 0) {
+    t->old[i].hash = DELETED;
+    t->size--;
+  }
+  if ((t->used + 1) * 4 > t->capa * 3) {
+    grow(pic, t);
+  }
+  insert(t, h, key, val);
+  t->size++;
+}
+
+void
+pic_table_del(pic_state *pic, pic_value table, pic_value key)
+{
+  struct table *t = table_ptr(pic, table);
+  struct bucket *e;
+
+  migrate(pic, t, TABLE_MIGRATE_STEP);
+
+  if ((e = lookup(pic, t, key)) != NULL) {
+    e->hash = DELETED;
+    t->size--;
+  }
+}
+
+bool
+pic_table_has(pic_state *pic, pic_value table, pic_value key)
+{
+  return lookup(pic, table_ptr(pic, table), key) != NULL;
+}
+
+int
+pic_table_size(pic_state *pic, pic_value table)
+{
+  return table_ptr(pic, table)->size;
+}
+
+bool
+pic_table_next(pic_state *pic, pic_value table, int *iter, pic_value *key, pic_value *val)
+{
+  struct table *t = table_ptr(pic, table);
+  struct bucket *e;
+  int it;
+
+  for (it = *iter; it < t->capa + t->old_capa; ++it) {
+    e = it < t->capa ? &t->b[it] : &t->old[it - t->capa];
+    if (e->hash > DELETED) {
+      if (key) *key = e->key;
+      if (val) *val = e->val;
+      *iter = ++it;
+      return true;
+    }
+  }
+  return false;
+}
+
+static pic_value
+table_equiv(pic_state *pic, struct table *t)
+{
+  switch (t->kind) {
+  case PIC_TABLE_EQ:
+    return pic_ref(pic, "eq?");
+  case PIC_TABLE_EQV:
+    return pic_ref(pic, "eqv?");
+  case PIC_TABLE_EQUAL:
+    return pic_ref(pic, "equal?");
+  case PIC_TABLE_STRING:
+    return pic_ref(pic, "string=?");
+  default:
+    return t->equal;
+  }
+}
+
+static pic_value
+table_from_args(pic_state *pic, int argc, pic_value *argv)
+{
+  pic_value equal;
+
+  if (argc == 0) {
+    return pic_make_table(pic, PIC_TABLE_EQUAL);
+  }
+  equal = argv[0];
+  TYPE_CHECK(pic, equal, proc);
+
+  if (pic_eq_p(pic, equal, pic_ref(pic, "eq?"))) {
+    return pic_make_table(pic, PIC_TABLE_EQ);
+  }
+  if (pic_eq_p(pic, equal, pic_ref(pic, "eqv?"))) {
+    return pic_make_table(pic, PIC_TABLE_EQV);
+  }
+  if (pic_eq_p(pic, equal, pic_ref(pic, "equal?"))) {
+    return pic_make_table(pic, PIC_TABLE_EQUAL);
+  }
+  if (pic_eq_p(pic, equal, pic_ref(pic, "string=?"))) {
+    return pic_make_table(pic, PIC_TABLE_STRING);
+  }
+  /* without a hash function, fall back to the one for equal? */
+  if (argc == 1 || ! pic_proc_p(pic, argv[1])) {
+    return make_table(pic, TABLE_CUSTOM, equal, pic_false_value(pic));
+  }
+  return make_table(pic, TABLE_CUSTOM, equal, argv[1]);
+}
+
+static pic_value
+hash_value(pic_state *pic, unsigned h, int argc, pic_value *argv)
+{
+  int bound;
+
+  h &= 0x7fffffff;
+  if (argc > 0) {
+    TYPE_CHECK(pic, argv[0], int);
+    if ((bound = pic_int(pic, argv[0])) <= 0) {
+      pic_error(pic, "hash: bound must be positive", 1, argv[0]);
+    }
+    h %= bound;
+  }
+  return pic_int_value(pic, h);
+}
+
+static pic_value
+pic_table_make_hash_table(pic_state *pic)
+{
+  pic_value *argv;
+  int argc;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  return table_from_args(pic, argc, argv);
+}
+
+static pic_value
+pic_table_hash_table_p(pic_state *pic)
+{
+  pic_value obj;
+
+  pic_get_args(pic, "o", &obj);
+
+  return pic_bool_value(pic, pic_table_p(pic, obj));
+}
+
+static pic_value
+pic_table_hash_table_ref(pic_state *pic)
+{
+  pic_value table, key, fail, succ;
+  struct bucket *e;
+  int n;
+
+  n = pic_get_args(pic, "ho|ll", &table, &key, &fail, &succ);
+
+  e = lookup(pic, table_ptr(pic, table), key);
+  if (e == NULL) {
+    if (n < 3) {
+      pic_error(pic, "hash-table-ref: element not found for given key", 1, key);
+    }
+    return pic_call(pic, fail, 0);
+  }
+  if (n < 4) {
+    return e->val;
+  }
+  return pic_call(pic, succ, 1, e->val);
+}
+
+static pic_value
+pic_table_hash_table_ref_default(pic_state *pic)
+{
+  pic_value table, key, def;
+  struct bucket *e;
+
+  pic_get_args(pic, "hoo", &table, &key, &def);
+
+  e = lookup(pic, table_ptr(pic, table), key);
+  return e ? e->val : def;
+}
+
+static pic_value
+pic_table_hash_table_set(pic_state *pic)
+{
+  pic_value table, *argv;
+  int argc, i;
+
+  pic_get_args(pic, "h*", &table, &argc, &argv);
+
+  if (argc % 2 != 0) {
+    pic_error(pic, "hash-table-set!: odd number of key/value arguments", 0);
+  }
+  for (i = 0; i < argc; i += 2) {
+    pic_table_set(pic, table, argv[i], argv[i + 1]);
+  }
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_delete(pic_state *pic)
+{
+  pic_value table, *argv;
+  int argc, i, size;
+
+  pic_get_args(pic, "h*", &table, &argc, &argv);
+
+  size = pic_table_size(pic, table);
+  for (i = 0; i < argc; ++i) {
+    pic_table_del(pic, table, argv[i]);
+  }
+  return pic_int_value(pic, size - pic_table_size(pic, table));
+}
+
+static pic_value
+pic_table_hash_table_contains_p(pic_state *pic)
+{
+  pic_value table, key;
+
+  pic_get_args(pic, "ho", &table, &key);
+
+  return pic_bool_value(pic, pic_table_has(pic, table, key));
+}
+
+static pic_value
+pic_table_hash_table_update(pic_state *pic)
+{
+  pic_value table, key, proc, fail, succ, val;
+  struct bucket *e;
+  int n;
+
+  n = pic_get_args(pic, "hol|ll", &table, &key, &proc, &fail, &succ);
+
+  e = lookup(pic, table_ptr(pic, table), key);
+  if (e == NULL) {
+    if (n < 4) {
+      pic_error(pic, "hash-table-update!: element not found for given key", 1, key);
+    }
+    val = pic_call(pic, fail, 0);
+  } else {
+    val = n < 5 ? e->val : pic_call(pic, succ, 1, e->val);
+  }
+  pic_table_set(pic, table, key, pic_call(pic, proc, 1, val));
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_update_default(pic_state *pic)
+{
+  pic_value table, key, proc, def;
+  struct bucket *e;
+
+  pic_get_args(pic, "holo", &table, &key, &proc, &def);
+
+  e = lookup(pic, table_ptr(pic, table), key);
+  pic_table_set(pic, table, key, pic_call(pic, proc, 1, e ? e->val : def));
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_size(pic_state *pic)
+{
+  pic_value table;
+
+  pic_get_args(pic, "h", &table);
+
+  return pic_int_value(pic, pic_table_size(pic, table));
+}
+
+static pic_value
+pic_table_hash_table_keys(pic_state *pic)
+{
+  pic_value table, key, list = pic_nil_value(pic);
+  int it = 0;
+
+  pic_get_args(pic, "h", &table);
+
+  while (pic_table_next(pic, table, &it, &key, NULL)) {
+    pic_push(pic, key, list);
+  }
+  return list;
+}
+
+static pic_value
+pic_table_hash_table_values(pic_state *pic)
+{
+  pic_value table, val, list = pic_nil_value(pic);
+  int it = 0;
+
+  pic_get_args(pic, "h", &table);
+
+  while (pic_table_next(pic, table, &it, NULL, &val)) {
+    pic_push(pic, val, list);
+  }
+  return list;
+}
+
+static pic_value
+pic_table_hash_table_to_alist(pic_state *pic)
+{
+  pic_value table, key, val, alist = pic_nil_value(pic);
+  int it = 0;
+
+  pic_get_args(pic, "h", &table);
+
+  while (pic_table_next(pic, table, &it, &key, &val)) {
+    pic_push(pic, pic_cons(pic, key, val), alist);
+  }
+  return alist;
+}
+
+static pic_value
+pic_table_hash_table_walk(pic_state *pic)
+{
+  pic_value table, proc, key, val;
+  int it = 0;
+  size_t ai;
+
+  pic_get_args(pic, "hl", &table, &proc);
+
+  ai = pic_enter(pic);
+  while (pic_table_next(pic, table, &it, &key, &val)) {
+    pic_call(pic, proc, 2, key, val);
+    pic_leave(pic, ai);
+  }
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_fold(pic_state *pic)
+{
+  pic_value table, proc, acc, key, val;
+  int it = 0;
+  size_t ai;
+
+  pic_get_args(pic, "hlo", &table, &proc, &acc);
+
+  ai = pic_enter(pic);
+  while (pic_table_next(pic, table, &it, &key, &val)) {
+    acc = pic_call(pic, proc, 3, key, val, acc);
+    pic_leave(pic, ai);
+    pic_protect(pic, acc);
+  }
+  return acc;
+}
+
+static pic_value
+pic_table_hash_table_copy(pic_state *pic)
+{
+  pic_value table, copy, mutable = pic_false_value(pic);
+  struct table *t, *u;
+  int it = 0;
+
+  pic_get_args(pic, "h|o", &table, &mutable);
+
+  t = table_ptr(pic, table);
+  copy = make_table(pic, t->kind, t->equal, t->hash);
+  u = table_ptr(pic, copy);
+  u->b = pic_calloc(pic, table_capa(t->size), sizeof(struct bucket));
+  u->capa = table_capa(t->size);
+
+  for (it = 0; it < t->capa + t->old_capa; ++it) {
+    struct bucket *e = it < t->capa ? &t->b[it] : &t->old[it - t->capa];
+    if (e->hash > DELETED) {
+      insert(u, e->hash, e->key, e->val);
+      u->size++;
+    }
+  }
+  return copy;
+}
+
+static pic_value
+pic_table_hash_table_clear(pic_state *pic)
+{
+  pic_value table;
+  struct table *t;
+
+  pic_get_args(pic, "h", &table);
+
+  t = table_ptr(pic, table);
+  pic_free(pic, t->b);
+  pic_free(pic, t->old);
+  t->b = t->old = NULL;
+  t->capa = t->used = t->size = 0;
+  t->old_capa = t->migrated = 0;
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_alist_to_hash_table(pic_state *pic)
+{
+  pic_value alist, table, e, it, *argv;
+  int argc;
+
+  pic_get_args(pic, "o*", &alist, &argc, &argv);
+
+  table = table_from_args(pic, argc, argv);
+
+  /* earlier associations take precedence */
+  pic_for_each (e, pic_reverse(pic, alist), it) {
+    pic_table_set(pic, table, pic_car(pic, e), pic_cdr(pic, e));
+  }
+  return table;
+}
+
+static pic_value
+pic_table_hash_table_equivalence_function(pic_state *pic)
+{
+  pic_value table;
+
+  pic_get_args(pic, "h", &table);
+
+  return table_equiv(pic, table_ptr(pic, table));
+}
+
+static pic_value
+pic_table_hash_table_hash_function(pic_state *pic)
+{
+  pic_value table;
+  struct table *t;
+
+  pic_get_args(pic, "h", &table);
+
+  t = table_ptr(pic, table);
+  switch (t->kind) {
+  case PIC_TABLE_EQ:
+  case PIC_TABLE_EQV:
+    return pic_ref(pic, "hash-by-identity");
+  case PIC_TABLE_STRING:
+    return pic_ref(pic, "string-hash");
+  default:
+    return pic_false_p(pic, t->hash) ? pic_ref(pic, "hash") : t->hash;
+  }
+}
+
+static pic_value
+pic_table_hash(pic_state *pic)
+{
+  pic_value obj, *argv;
+  int argc, budget = HASH_BUDGET;
+
+  pic_get_args(pic, "o*", &obj, &argc, &argv);
+
+  return hash_value(pic, hash_equal(pic, obj, &budget), argc, argv);
+}
+
+static pic_value
+pic_table_string_hash(pic_state *pic)
+{
+  pic_value str, *argv;
+  int argc;
+
+  pic_get_args(pic, "s*", &str, &argc, &argv);
+
+  return hash_value(pic, pic_str_hash(pic, str), argc, argv);
+}
+
+static pic_value
+pic_table_hash_by_identity(pic_state *pic)
+{
+  pic_value obj, *argv;
+  int argc;
+
+  pic_get_args(pic, "o*", &obj, &argc, &argv);
+
+  return hash_value(pic, hash_eq(pic, obj), argc, argv);
+}
+
+void
+pic_init_table(pic_state *pic)
+{
+  pic_defun(pic, "make-hash-table", pic_table_make_hash_table);
+  pic_defun(pic, "hash-table?", pic_table_hash_table_p);
+  pic_defun(pic, "hash-table-ref", pic_table_hash_table_ref);
+  pic_defun(pic, "hash-table-ref/default", pic_table_hash_table_ref_default);
+  pic_defun(pic, "hash-table-set!", pic_table_hash_table_set);
+  pic_defun(pic, "hash-table-delete!", pic_table_hash_table_delete);
+  pic_defun(pic, "hash-table-contains?", pic_table_hash_table_contains_p);
+  pic_defun(pic, "hash-table-exists?", pic_table_hash_table_contains_p);
+  pic_defun(pic, "hash-table-update!", pic_table_hash_table_update);
+  pic_defun(pic, "hash-table-update!/default", pic_table_hash_table_update_default);
+  pic_defun(pic, "hash-table-size", pic_table_hash_table_size);
+  pic_defun(pic, "hash-table-keys", pic_table_hash_table_keys);
+  pic_defun(pic, "hash-table-values", pic_table_hash_table_values);
+  pic_defun(pic, "hash-table->alist", pic_table_hash_table_to_alist);
+  pic_defun(pic, "hash-table-walk", pic_table_hash_table_walk);
+  pic_defun(pic, "hash-table-fold", pic_table_hash_table_fold);
+  pic_defun(pic, "hash-table-copy", pic_table_hash_table_copy);
+  pic_defun(pic, "hash-table-clear!", pic_table_hash_table_clear);
+  pic_defun(pic, "alist->hash-table", pic_table_alist_to_hash_table);
+  pic_defun(pic, "hash-table-equivalence-function", pic_table_hash_table_equivalence_function);
+  pic_defun(pic, "hash-table-hash-function", pic_table_hash_table_hash_function);
+  pic_defun(pic, "hash", pic_table_hash);
+  pic_defun(pic, "string-hash", pic_table_string_hash);
+  pic_defun(pic, "hash-by-identity", pic_table_hash_by_identity);
+}
@@ -112,8 +112,10 @@ DEFPRED(pic_str_p, PIC_TYPE_STRING)
 DEFPRED(pic_vec_p, PIC_TYPE_VECTOR)
 DEFPRED(pic_blob_p, PIC_TYPE_BLOB)
 DEFPRED(pic_dict_p, PIC_TYPE_DICT)
+DEFPRED(pic_table_p, PIC_TYPE_TABLE)
 DEFPRED(pic_attr_p, PIC_TYPE_ATTR)
 DEFPRED(pic_rec_p, PIC_TYPE_RECORD)
+DEFPRED(pic_rectype_p, PIC_TYPE_RECORD_TYPE)
 DEFPRED(pic_sym_p, PIC_TYPE_SYMBOL)
 DEFPRED(pic_pair_p, PIC_TYPE_PAIR)
 DEFPRED(pic_proc_func_p, PIC_TYPE_PROC_FUNC)
@@ -36,6 +36,9 @@ enum {
   PIC_TYPE_PROC_IREP = 28,
   PIC_TYPE_ROPE_LEAF = 29,
   PIC_TYPE_ROPE_NODE = 30,
+  PIC_TYPE_ROPE_SLICE = 31,
+  PIC_TYPE_TABLE     = 32,
+  PIC_TYPE_RECORD_TYPE = 33,
   PIC_TYPE_MAX       = 63
 };
 
@@ -236,8 +239,10 @@ DEFPRED(str, PIC_TYPE_STRING)
 DEFPRED(vec, PIC_TYPE_VECTOR)
 DEFPRED(blob, PIC_TYPE_BLOB)
 DEFPRED(dict, PIC_TYPE_DICT)
+DEFPRED(table, PIC_TYPE_TABLE)
 DEFPRED(attr, PIC_TYPE_ATTR)
 DEFPRED(rec, PIC_TYPE_RECORD)
+DEFPRED(rectype, PIC_TYPE_RECORD_TYPE)
 DEFPRED(sym, PIC_TYPE_SYMBOL)
 DEFPRED(pair, PIC_TYPE_PAIR)
 DEFPRED(proc_func, PIC_TYPE_PROC_FUNC)
@@ -260,6 +265,7 @@ pic_value pic_obj_value(pic_state *, void *, int);
 bool pic_invalid_p(pic_state *, pic_value);
 bool pic_attr_p(pic_state *, pic_value);
 bool pic_rec_p(pic_state *, pic_value);
+bool pic_rectype_p(pic_state *, pic_value);
 bool pic_irep_p(pic_state *, pic_value);
 bool pic_proc_func_p(pic_state *, pic_value);
 bool pic_proc_irep_p(pic_state *, pic_value);
@@ -7,7 +7,16 @@
 #include "object.h"
 #include "state.h"
 
-/* implementated by deep binding */
+/*
+ * Implemented by shallow binding: every parameter keeps its current value
+ * in its closure and the dynamic environment is a tree of saved bindings.
+ * A node is ((var . val) . next). The current environment is the root
+ * (next is nil); any other node means "var is bound to val, everything
+ * else is as in next". Switching environments reroots the tree, swapping
+ * the saved values with the live ones along the path.
+ */
+
+#define var_value(pic, var) (proc_ptr(pic, var)->env->regs[1])
 
 static pic_value
 var_call(pic_state *pic)
@@ -18,14 +27,7 @@ var_call(pic_state *pic)
   n = pic_get_args(pic, "&|o", &self, &val);
 
   if (n == 0) {
-    pic_value env, it;
-
-    pic_for_each(env, pic_ref(pic, "__picrin_dynenv__"), it) {
-      if (pic_attr_has(pic, env, self)) {
-        return pic_attr_ref(pic, env, self);
-      }
-    }
-    PIC_UNREACHABLE();          /* logic flaw */
+    return pic_closure_ref(pic, 1);
   } else {
     pic_value conv;
 
@@ -33,28 +35,60 @@ var_call(pic_state *pic)
     if (! pic_false_p(pic, conv)) {
       val = pic_call(pic, conv, 1, val);
     }
-    pic_attr_set(pic, pic_car(pic, pic_ref(pic, "__picrin_dynenv__")), self, val);
+    pic_dynenv_bind(pic, self, val);
     return pic_undef_value(pic);
   }
 }
 
+void
+pic_dynenv_bind(pic_state *pic, pic_value var, pic_value val)
+{
+  pic_value root = pic->dyn_env, next, bind;
+
+  next = pic_cons(pic, pic_cons(pic, pic_false_value(pic), pic_false_value(pic)), pic_nil_value(pic));
+  bind = pic_car(pic, root);
+  pic_set_car(pic, bind, var);
+  pic_set_cdr(pic, bind, var_value(pic, var));
+  pic_set_cdr(pic, root, next);
+  var_value(pic, var) = val;
+  pic->dyn_env = next;
+}
+
+void
+pic_dynenv_reroot(pic_state *pic, pic_value env)
+{
+  pic_value prev, node, next, bind, var, val;
+
+  /* reverse the path so that it runs from the current root to env */
+  prev = pic_nil_value(pic);
+  for (node = env; ! pic_nil_p(pic, node); node = next) {
+    next = pic_cdr(pic, node);
+    pic_set_cdr(pic, node, prev);
+    prev = node;
+  }
+  assert(pic_eq_p(pic, prev, pic->dyn_env));
+
+  /* move the root one step at a time */
+  for (node = prev; ! pic_eq_p(pic, node, env); node = next) {
+    next = pic_cdr(pic, node);
+    bind = pic_car(pic, next);
+    var = pic_car(pic, bind);
+    val = pic_cdr(pic, bind);
+    pic_set_cdr(pic, bind, var_value(pic, var));
+    var_value(pic, var) = val;
+    pic_set_car(pic, next, pic_car(pic, node));
+    pic_set_car(pic, node, bind);
+  }
+  pic->dyn_env = env;
+}
+
 pic_value
 pic_make_var(pic_state *pic, pic_value init, pic_value conv)
 {
-  pic_value var, env = pic_ref(pic, "__picrin_dynenv__");
-
-  var = pic_lambda(pic, var_call, 1, conv);
-  while (1) {
-    if (pic_nil_p(pic, pic_cdr(pic, env))) { /* top dyn env */
-      if (! pic_false_p(pic, conv)) {
-        init = pic_call(pic, conv, 1, init);
-      }
-      pic_attr_set(pic, pic_car(pic, env), var, init);
-      break;
-    }
-    env = pic_cdr(pic, env);
+  if (! pic_false_p(pic, conv)) {
+    init = pic_call(pic, conv, 1, init);
   }
-  return var;
+  return pic_lambda(pic, var_call, 2, conv, init);
 }
 
 static pic_value
@@ -76,9 +110,9 @@ pic_var_current_dynamic_environment(pic_state *pic)
   n = pic_get_args(pic, "|o", &dyn_env);
 
   if (n == 0) {
-    return pic_ref(pic, "__picrin_dynenv__");
+    return pic->dyn_env;
   } else {
-    pic_set(pic, "__picrin_dynenv__", dyn_env);
+    pic_dynenv_reroot(pic, dyn_env);
     return pic_undef_value(pic);
   }
 }
@@ -86,6 +120,7 @@ pic_var_current_dynamic_environment(pic_state *pic)
 void
 pic_init_var(pic_state *pic)
 {
+  pic_register_func(pic, "parameter", var_call);
   pic_defun(pic, "make-parameter", pic_var_make_parameter);
   pic_defun(pic, "current-dynamic-environment", pic_var_current_dynamic_environment);
 }
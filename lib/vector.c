@@ -225,8 +225,8 @@ pic_vec_vector_fill_i(pic_state *pic)
 static pic_value
 pic_vec_vector_map(pic_state *pic)
 {
-  int argc, i, len, j;
-  pic_value proc, *argv, vec, vals;
+  int argc, i;
+  pic_value proc, *argv;
 
   pic_get_args(pic, "l*", &proc, &argc, &argv);
 
@@ -234,33 +234,18 @@ pic_vec_vector_map(pic_state *pic)
     pic_error(pic, "vector-map: wrong number of arguments (1 for at least 2)", 0);
   }
 
-  len = INT_MAX;
   for (i = 0; i < argc; ++i) {
-    int l;
     TYPE_CHECK(pic, argv[i], vec);
-    l = pic_vec_len(pic, argv[i]);
-    len = len < l ? len : l;
   }
 
-  vec = pic_make_vec(pic, len, NULL);
-
-  for (i = 0; i < len; ++i) {
-    vals = pic_nil_value(pic);
-    for (j = 0; j < argc; ++j) {
-      pic_push(pic, pic_vec_ref(pic, argv[j], i), vals);
-    }
-    vals = pic_reverse(pic, vals);
-    pic_vec_set(pic, vec, i, pic_funcall(pic, "apply", 2, proc, vals));
-  }
-
-  return vec;
+  return pic_mapk(pic, PIC_TYPE_VECTOR, proc, argc, argv, true);
 }
 
 static pic_value
 pic_vec_vector_for_each(pic_state *pic)
 {
-  int argc, i, len, j;
-  pic_value proc, *argv, vals;
+  int argc, i;
+  pic_value proc, *argv;
 
   pic_get_args(pic, "l*", &proc, &argc, &argv);
 
@@ -268,24 +253,11 @@ pic_vec_vector_for_each(pic_state *pic)
     pic_error(pic, "vector-for-each: wrong number of arguments (1 for at least 2)", 0);
   }
 
-  len = INT_MAX;
   for (i = 0; i < argc; ++i) {
-    int l;
     TYPE_CHECK(pic, argv[i], vec);
-    l = pic_vec_len(pic, argv[i]);
-    len = len < l ? len : l;
   }
 
-  for (i = 0; i < len; ++i) {
-    vals = pic_nil_value(pic);
-    for (j = 0; j < argc; ++j) {
-      pic_push(pic, pic_vec_ref(pic, argv[j], i), vals);
-    }
-    vals = pic_reverse(pic, vals);
-    pic_funcall(pic, "apply", 2, proc, vals);
-  }
-
-  return pic_undef_value(pic);
+  return pic_mapk(pic, PIC_TYPE_VECTOR, proc, argc, argv, false);
 }
 
 static pic_value
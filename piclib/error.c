@@ -2,7 +2,7 @@
  * See Copyright Notice in picrin.h
  */
 
-#include "picrin.h"
+#include <picrin.h>
 #include "../value.h"
 #include "../object.h"
 #include "../state.h"
@@ -20,7 +20,9 @@ pic_prepare_try(pic_state *pic)
   cxt->fp = NULL;
   cxt->sp = NULL;
   cxt->irep = NULL;
-  cxt->conts = pic_nil_value(pic);
+  cxt->foreign = false;
+  cxt->id = ++pic->cxt_id;
+  cxt->dyn_env = pic->dyn_env;
   cxt->prev = pic->cxt;
   pic->cxt = cxt;
   return &cxt->jmp;
@@ -41,7 +43,7 @@ void
 pic_enter_try(pic_state *pic)
 {
   pic_value cont, handler;
-  pic_value var, env;
+  pic_value var;
 
   pic->cxt->ai = pic->ai;
 
@@ -50,9 +52,7 @@ pic_enter_try(pic_state *pic)
   handler = pic_lambda(pic, native_exception_handler, 1, cont);
   /* with-exception-handler */
   var = pic_exc(pic);
-  env = pic_make_attr(pic);
-  pic_attr_set(pic, env, var, pic_cons(pic, handler, pic_call(pic, var, 0)));
-  pic->dyn_env = pic_cons(pic, env, pic->dyn_env);
+  pic_dynenv_bind(pic, var, pic_cons(pic, handler, pic_call(pic, var, 0)));
 
   pic_leave(pic, pic->cxt->ai);
 }
@@ -61,25 +61,24 @@ void
 pic_exit_try(pic_state *pic)
 {
   struct context *cxt = pic->cxt;
-  pic_value c, it;
-  pic->dyn_env = pic_cdr(pic, pic->dyn_env);
-  pic_for_each (c, cxt->conts, it) {
-    proc_ptr(pic, c)->env->regs[0] = pic_false_value(pic);
-  }
+  pic_dynenv_reroot(pic, cxt->dyn_env);
   pic->cxt = cxt->prev;
   pic_free(pic, cxt);
   /* don't rewind ai here */
 }
 
+void
+pic_raise(pic_state *pic, pic_value err)
+{
+  pic_funcall(pic, "raise", 1, err);
+  PIC_UNREACHABLE();
+}
+
 pic_value
 pic_abort_try(pic_state *pic)
 {
   struct context *cxt = pic->cxt;
-  pic_value c, it;
   pic_value err = cxt->sp->regs[1];
-  pic_for_each (c, cxt->conts, it) {
-    proc_ptr(pic, c)->env->regs[0] = pic_false_value(pic);
-  }
   pic->cxt = cxt->prev;
   pic_free(pic, cxt);
   pic_protect(pic, err);
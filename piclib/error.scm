@@ -34,7 +34,7 @@
   (set! display
         (let ((d display))
           (lambda (x . port)
-            (let ((port (if (null? port) (current-error-port) (car port))))
+            (let ((port (if (null? port) (current-output-port) (car port))))
               (if (error-object? x)
                   (let ()
                     (when (error-object-type x)
@@ -42,7 +42,7 @@
                       (d "-" port))
                     (d "error: \"" port)
                     (d (error-object-message x) port)
-                    (d "\"")
+                    (d "\"" port)
                     (for-each
                      (lambda (x)
                        (d " " port)
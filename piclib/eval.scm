@@ -14,9 +14,42 @@
                   add-identifier!
                   set-identifier!
                   macro-objects
-                  expand)
+                  expand
+                  identifier-count
+                  current-journal
+                  replay-journal)
     (let ()
 
+      ;; journal
+      ;;
+      ;; While current-journal holds a procedure, every change the expander
+      ;; makes to the top-level state is passed to it as a list: (bind id
+      ;; uid env), (macro uid proc), (unmacro uid), (uniq n), where n is the
+      ;; next identifier number, and (run proc) from eval. proc is compiled
+      ;; code, which yields the macro transformer in the case of macro.
+      ;; Handing these entries to replay-journal in order redoes the effects
+      ;; without expanding or compiling anything. (include filename) notes
+      ;; a file read by the include syntax and has nothing to redo.
+
+      (define current-journal
+        (make-parameter #f))
+
+      (define (journal entry)
+        (let ((j (current-journal)))
+          (if j (j entry))))
+
+      ;; running compiled code again replays what it does, but for the
+      ;; identifiers it may number
+      (define (run proc)
+        (let ((j (current-journal)))
+          (if j
+              (parameterize ((current-journal
+                              (lambda (entry)
+                                (if (eq? (car entry) 'uniq)
+                                    (j entry)))))
+                (proc))
+              (proc))))
+
       ;; identifier
 
       (define-record-type identifier
@@ -68,34 +101,40 @@
                       (find-identifier (identifier-name id)
                                        (identifier-environment id)))))))
 
-      (define add-identifier!
-        (let ((uniq
-               (let ((n 0))
-                 (lambda (id)
-                   (let ((m n))
-                     (set! n (+ n 1))
-                     (string->symbol
-                      (string-append
-                       "."
-                       (symbol->string
-                        (let loop ((id id))
-                          (if (symbol? id)
-                              id
-                              (loop (identifier-name id)))))
-                       "."
-                       (number->string m))))))))
-          (lambda (id env)
-            (or (search-scope id env)
-                (if (and (not (environment-parent env)) (symbol? id))
-                    (string->symbol
-                     (string-append
-                      (environment-prefix env)
-                      (symbol->string id)))
-                    (let ((uid (uniq id)))
-                      (set-identifier! id uid env)
-                      uid))))))
+      (define uniq-count 0)
+
+      (define (identifier-count)
+        uniq-count)
+
+      (define (uniq id)
+        (let ((m uniq-count))
+          (set! uniq-count (+ m 1))
+          (journal `(uniq ,uniq-count))
+          (string->symbol
+           (string-append
+            "."
+            (symbol->string
+             (let loop ((id id))
+               (if (symbol? id)
+                   id
+                   (loop (identifier-name id)))))
+            "."
+            (number->string m)))))
+
+      (define (add-identifier! id env)
+        (or (search-scope id env)
+            (if (and (not (environment-parent env)) (symbol? id))
+                (string->symbol
+                 (string-append
+                  (environment-prefix env)
+                  (symbol->string id)))
+                (let ((uid (uniq id)))
+                  (set-identifier! id uid env)
+                  uid))))
 
       (define (set-identifier! id uid env)
+        (unless (environment-parent env)
+          (journal `(bind ,id ,uid ,env)))
         ((environment-binding env) id uid))
 
       (define (make-environment prefix)
@@ -111,7 +150,9 @@
              core#lambda
              core#if
              core#begin
-             core#define-macro))
+             core#define-macro
+             core#record-ref
+             core#record-set!))
           (lambda ()
             env)))
 
@@ -133,11 +174,23 @@
 
       (define (shadow-macro! uid)
         (when (dictionary-has? global-macro-table uid)
+          (journal `(unmacro ,uid))
           (dictionary-delete! global-macro-table uid)))
 
       (define (macro-objects)
         global-macro-table)
 
+      (define (replay-journal entry)
+        (let ((args (cdr entry)))
+          (case (car entry)
+            ((bind) (apply set-identifier! args))
+            ((macro) (add-macro! (car args) (run (cadr args))))
+            ((unmacro) (apply shadow-macro! args))
+            ((uniq) (if (< uniq-count (car args)) (set! uniq-count (car args))))
+            ((run) (run (car args)))
+            ((include) #f)
+            (else (error "replay-journal: unknown entry" entry)))))
+
 
       ;; expander
 
@@ -199,8 +252,9 @@
 
           (define (expand-define-macro var transformer env)
             (let ((uid (add-identifier! var env)))
-              (let ((expander (eval transformer env)))
-                (add-macro! uid expander)
+              (let ((proc (compile transformer env)))
+                (journal `(macro ,uid ,proc))
+                (add-macro! uid (run proc))
                 #undefined)))
 
           (define (expand-node expr env)
@@ -225,9 +279,10 @@
               (error "invalid expression" expr))))
 
           (define (expand expr . env)
-            (let ((x (expand-node expr (if (null? env) (default-environment) (car env)))))
-              (run-all)
-              x))
+            (parameterize ((task-queue '()))
+              (let ((x (expand-node expr (if (null? env) (default-environment) (car env)))))
+                (run-all)
+                x)))
 
           expand))
 
@@ -243,7 +298,10 @@
               add-identifier!
               set-identifier!
               macro-objects
-              expand)))
+              expand
+              identifier-count
+              current-journal
+              replay-journal)))
 
 
   ;; built-in macros
@@ -586,12 +644,9 @@
         (lambda (form env)
           (let ((formal (car (cdr form)))
                 (body   (cdr (cdr form))))
-            (let ((table (the 'table))
-                  (prev (the 'prev))
+            (let ((prev (the 'prev))
                   (it (the 'it)))
-              `(,(the 'let) ((,table (,(the 'make-attribute)))
-                             (,prev (,(the 'current-dynamic-environment))))
-                (,(the 'current-dynamic-environment) (,(the 'cons) ,table ,prev))
+              `(,(the 'let) ((,prev (,(the 'current-dynamic-environment))))
                 (,the-begin . ,formal)
                 (,(the 'let) ((,it (,the-begin . ,body)))
                  (,(the 'current-dynamic-environment) ,prev)
@@ -603,28 +658,35 @@
                 (ctor (car (cdr (cdr form))))
                 (pred (car (cdr (cdr (cdr form)))))
                 (fields (cdr (cdr (cdr (cdr form))))))
-            `(,the-begin
-              (,the-define ,ctor
-                           (,(the 'make-record) ',type
-                            (,(the 'vector) . ,(map (lambda (field) (if (memq (car field) (cdr ctor)) (car field) #undefined)) fields))))
-              (,the-define ,pred
-                           (,(the 'lambda) (obj)
-                            (,(the 'and) (,(the 'record?) obj) (,(the 'eq?) (,(the 'record-type) obj) ',type))))
-              . ,(let loop ((fields fields) (pos 0) (acc '()))
-                   (if (null? fields)
-                       acc
-                       (let ((field (car fields)))
-                         (let ((defs `((,the-define (,(cadr field) obj)
-                                                    (,the-if (,pred obj)
-                                                             (,(the 'vector-ref) (,(the 'record-datum) obj) ,pos)
-                                                             (,(the 'error) "record type mismatch" obj ',type)))
-                                       . ,(if (null? (cddr field))
-                                              '()
-                                              `((,the-define (,(car (cddr field)) obj value)
-                                                             (,the-if (,pred obj)
-                                                                      (,(the 'vector-set!) (,(the 'record-datum) obj) ,pos value)
-                                                                      (,(the 'error) "record type mismatch" obj ',type))))))))
-                           (loop (cdr fields) (+ pos 1) `(,@defs . ,acc))))))))))
+            ;; the procedures close over the descriptor rather than refer to
+            ;; the variable, which a later definition of the type may rebind
+            (let ((rtd (the 'rtd)))
+              (define (with-type formals body)
+                `(,(the 'let) ((,rtd ,type))
+                  (,(the 'lambda) ,formals ,body)))
+              `(,the-begin
+                (,the-define ,type
+                             (,(the 'make-record-type) ',type ',(map car fields)))
+                (,the-define ,(car ctor)
+                             ,(with-type (cdr ctor)
+                                         `(,(the 'make-record) ,rtd
+                                           . ,(map (lambda (field) (if (memq (car field) (cdr ctor)) (car field) #undefined)) fields))))
+                (,the-define ,pred
+                             ,(with-type '(obj)
+                                         `(,(the 'and) (,(the 'record?) obj) (,(the 'eq?) (,(the 'record-type) obj) ,rtd))))
+                . ,(let loop ((fields fields) (pos 0) (acc '()))
+                     (if (null? fields)
+                         acc
+                         (let ((field (car fields)))
+                           (let ((defs `((,the-define ,(cadr field)
+                                                      ,(with-type '(obj)
+                                                                  `(,(the 'core#record-ref) obj ,rtd ,pos)))
+                                         . ,(if (null? (cddr field))
+                                                '()
+                                                `((,the-define ,(car (cddr field))
+                                                               ,(with-type '(obj value)
+                                                                           `(,(the 'core#record-set!) obj ,rtd ,pos value))))))))
+                             (loop (cdr fields) (+ pos 1) `(,@defs . ,acc)))))))))))
 
       (define-transformer 'include
         (letrec ((read-file
@@ -637,7 +699,10 @@
                               (reverse exprs))
                             (loop (read port) (cons expr exprs))))))))
           (lambda (form env)
-            (let ((filenames (cdr form)))
+            (let ((filenames (cdr form))
+                  (journal (current-journal)))
+              (if journal
+                  (for-each (lambda (filename) (journal `(include ,filename))) filenames))
               (let ((exprs (apply append (map read-file filenames))))
                 `(,the-begin . ,exprs))))))))
 
@@ -683,6 +748,8 @@
                 ((core#set!) `(set! ,(cadr e) ,(normalize (caddr e))))
                 ((core#if) `(if . ,(map normalize (cdr e))))
                 ((core#begin) `(begin . ,(map normalize (cdr e))))
+                ((core#record-ref) `(rref ,(cadddr e) ,(normalize (cadr e)) ,(normalize (caddr e))))
+                ((core#record-set!) `(rset ,(cadddr e) ,(normalize (cadr e)) ,(normalize (caddr e)) ,(normalize (car (cddr (cddr e))))))
                 (else
                  (map normalize e))))))
 
@@ -698,11 +765,13 @@
           ;; E ::= A
           ;;     | (if A E E)
           ;;     | (set! v A E)
+          ;;     | (rset k A A A E)
           ;;     | (A A ...)
           ;; A ::= (lambda (var ...) E)
           ;;     | (ref v)
           ;;     | (quote x)
           ;;     | (undefined)
+          ;;     | (rref k A A)
 
           (define uniq
             (let ((n 0))
@@ -720,6 +789,12 @@
               ((set!) (transform-k (caddr e)
                                    (lambda (v)
                                      `(set! ,(cadr e) ,v ,(k '(undefined))))))
+              ((rref) (transform*-k (cddr e)
+                                    (lambda (args)
+                                      (k `(rref ,(cadr e) . ,args)))))
+              ((rset) (transform*-k (cddr e)
+                                    (lambda (args)
+                                      `(rset ,(cadr e) ,@args ,(k '(undefined))))))
               ((if) (let ((v (uniq))
                           (c (uniq)))
                       `((lambda (,c)
@@ -756,6 +831,12 @@
               ((set!) (transform-k (caddr e)
                                    (lambda (v)
                                      `(set! ,(cadr e) ,v (,c (undefined))))))
+              ((rref) (transform*-k (cddr e)
+                                    (lambda (args)
+                                      `(,c (rref ,(cadr e) . ,args)))))
+              ((rset) (transform*-k (cddr e)
+                                    (lambda (args)
+                                      `(rset ,(cadr e) ,@args (,c (undefined))))))
               ((if) (if (and (pair? c) (eq? 'lambda (car c)))
                         (let ((k (uniq)))
                           `((lambda (,k)
@@ -837,6 +918,13 @@
           (define (emit-label label)
             (code (cons label (code))))
 
+          ;; number of registers needed to compute atom e into register i;
+          ;; (rref k A A) uses register i + 1 for the record type
+          (define (atom-size e i)
+            (if (eq? 'rref (car e))
+                (max (atom-size (caddr e) i) (atom-size (cadddr e) (+ i 1)))
+                (+ i 1)))
+
           (define (codegen-e e)
             (case (car e)
               ((ref lambda quote undefined) (codegen-a e 0))
@@ -848,6 +936,12 @@
                                 (emit `(GSET 0 ,i)))
                               (emit `(LSET 0 . ,(cdr x)))))
                         (codegen-e (cadddr e))))
+              ((rset) (begin
+                        (codegen-a (caddr e) 0)
+                        (codegen-a (cadddr e) 1)
+                        (codegen-a (car (cddr (cddr e))) 2)
+                        (emit `(RSET 0 ,(cadr e)))
+                        (codegen-e (cadr (cddr (cddr e))))))
               ((if) (begin
                       (codegen-a (cadr e) 0)
                       (let ((label (make-label)))
@@ -878,13 +972,22 @@
                                (else (let ((n (emit-obj obj)))
                                        (emit `(LOAD ,i ,n)))))))
               ((undefined) (emit `(LOADU ,i)))
+              ((rref) (begin
+                        (codegen-a (caddr e) i)
+                        (codegen-a (cadddr e) (+ i 1))
+                        (emit `(RREF ,i ,(cadr e)))))
               ((lambda) (let ((frame-size
                                (let loop ((e (caddr e)))
                                  (case (car e)
-                                   ((ref lambda quote undefined) 1)
-                                   ((if) (max (loop (caddr e)) (loop (cadddr e))))
-                                   ((set!) (loop (cadddr e)))
-                                   (else (+ 1 (length e))))))
+                                   ((ref lambda quote undefined rref) (atom-size e 0))
+                                   ((if) (max (atom-size (cadr e) 0) (max (loop (caddr e)) (loop (cadddr e)))))
+                                   ((set!) (max (atom-size (caddr e) 0) (loop (cadddr e))))
+                                   ((rset) (max (max (atom-size (caddr e) 0) (atom-size (cadddr e) 1))
+                                                (max (atom-size (car (cddr (cddr e))) 2) (loop (cadr (cddr (cddr e)))))))
+                                   (else (let scan ((e e) (i 0) (n (+ 1 (length e))))
+                                           (if (null? e)
+                                               n
+                                               (scan (cdr e) (+ i 1) (max n (atom-size (car e) i)))))))))
                               (argc-varg
                                (let loop ((args (cadr e)) (c 0))
                                  (if (symbol? args)
@@ -914,5 +1017,8 @@
   ;; eval
 
   (define (eval expr . env)
-    ((apply compile expr env))))
+    (let ((entry `(run ,(apply compile expr env))))
+      (let ((journal (current-journal)))
+        (if journal (journal entry)))
+      (replay-journal entry))))
 
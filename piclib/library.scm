@@ -4,7 +4,12 @@
                 library-environment
                 library-exports
                 library-import
-                library-export)
+                library-export
+                make-library-image
+                read-library-image
+                load-library-image
+                library-image-reference
+                add-library-loader!)
   (let ()
     ;; There are two ways to name a library: (foo bar) or foo.bar
     ;; The former is normalized to the latter.
@@ -44,8 +49,41 @@
     (define *libraries*
       (make-dictionary))
 
+    (define (journal entry)
+      (let ((j (current-journal)))
+        (if j (j entry))))
+
+    ;; A library registered with add-library-loader! is made by calling its
+    ;; loaders, at the first time its environment or exports are needed.
+
+    (define *loaders*
+      (make-dictionary))
+
+    (define (add-library-loader! names thunk)
+      (let ((thunk (let ((done #f))
+                     (lambda ()
+                       (unless done
+                         (set! done #t)
+                         (thunk))))))
+        (for-each
+         (lambda (name)
+           (let ((name (mangle name)))
+             (dictionary-set! *loaders* name
+                              (if (dictionary-has? *loaders* name)
+                                  (append (dictionary-ref *loaders* name) (list thunk))
+                                  (list thunk)))))
+         names)))
+
+    (define (instantiate-library! name)
+      (when (dictionary-has? *loaders* name)
+        (let ((thunks (dictionary-ref *loaders* name)))
+          (dictionary-delete! *loaders* name)
+          (for-each (lambda (thunk) (thunk)) thunks))))
+
     (define (find-library name)
-      (dictionary-has? *libraries* (mangle name)))
+      (let ((name (mangle name)))
+        (or (dictionary-has? *libraries* name)
+            (dictionary-has? *loaders* name))))
 
     (define (make-library name)
       (let ((name (mangle name)))
@@ -57,13 +95,18 @@
           (set-identifier! 'import 'import env)
           (set-identifier! 'export 'export env)
           (set-identifier! 'cond-expand 'cond-expand env)
+          (journal `(library ,name ,env ,exports))
           (dictionary-set! *libraries* name `(,env . ,exports)))))
 
     (define (library-environment name)
-      (car (dictionary-ref *libraries* (mangle name))))
+      (let ((name (mangle name)))
+        (instantiate-library! name)
+        (car (dictionary-ref *libraries* name))))
 
     (define (library-exports name)
-      (cdr (dictionary-ref *libraries* (mangle name))))
+      (let ((name (mangle name)))
+        (instantiate-library! name)
+        (cdr (dictionary-ref *libraries* name))))
 
     (define (library-import name sym alias)
       (let ((uid (dictionary-ref (library-exports name) sym)))
@@ -73,7 +116,121 @@
     (define (library-export sym alias)
       (let ((env (library-environment (current-library)))
             (exports (library-exports (current-library))))
-        (dictionary-set! exports alias (find-identifier sym env))))
+        (let ((uid (find-identifier sym env)))
+          (journal `(export ,exports ,alias ,uid))
+          (dictionary-set! exports alias uid))))
+
+
+
+    ;; library images
+    ;;
+    ;; An image is the journal of evaluating some code, typically a file
+    ;; of define-library forms, in a bytevector. Loading it gives the same
+    ;; libraries, macros and global variables without expanding or
+    ;; compiling the code again. Objects that existed before the code ran,
+    ;; such as the values of global variables and the environments of
+    ;; other libraries, are referred to by name. A library the code imports
+    ;; is instantiated before the bindings it provides are replayed.
+    ;; Reading an image whose references cannot be resolved any more
+    ;; fails before anything is replayed.
+
+    (define environment-type
+      (record-type (default-environment)))
+
+    (define identifier-type
+      (record-type (make-identifier 'x (default-environment))))
+
+    (define (exports-library exports)
+      (let ((name #f))
+        (dictionary-for-each
+         (lambda (lib)
+           (if (eq? (cdr (dictionary-ref *libraries* lib)) exports)
+               (set! name lib)))
+         *libraries*)
+        name))
+
+    (define (make-library-image thunk)
+      (let ((externs (make-hash-table eq?))
+            (entries '())
+            (includes '()))
+        (dictionary-for-each
+         (lambda (uid)
+           (hash-table-set! externs (dictionary-ref (global-objects) uid) `(global . ,uid)))
+         (global-objects))
+        (dictionary-for-each
+         (lambda (name)
+           (let ((lib (dictionary-ref *libraries* name)))
+             (hash-table-set! externs (car lib) `(environment . ,name))
+             (hash-table-set! externs (cdr lib) `(exports . ,name))))
+         *libraries*)
+        (hash-table-set! externs environment-type '(record-type . environment))
+        (hash-table-set! externs identifier-type '(record-type . identifier))
+        (parameterize ((current-journal
+                        (lambda (entry)
+                          ;; only the latest of consecutive uniq entries counts
+                          (cond
+                           ((eq? (car entry) 'include)
+                            (set! includes (cons (cadr entry) includes)))
+                           ((and (eq? (car entry) 'uniq)
+                                 (pair? entries)
+                                 (eq? (car (car entries)) 'uniq))
+                            (set-car! entries entry))
+                           (else
+                            (set! entries (cons entry entries)))))))
+          (thunk))
+        ;; returns the image, the identifier count after the code ran, the
+        ;; names of the libraries it made or exported to and the files it
+        ;; included
+        (let ((count #f)
+              (names '()))
+          (for-each
+           (lambda (entry)
+             (let ((name (case (car entry)
+                           ((library) (cadr entry))
+                           ((export) (exports-library (cadr entry)))
+                           (else #f))))
+               (if (and name (not (memq name names)))
+                   (set! names (cons name names))))
+             (if (and (not count) (eq? (car entry) 'uniq))
+                 (set! count (cadr entry))))
+           entries)
+          (list (object->bytevector (reverse entries)
+                                    (lambda (obj)
+                                      (hash-table-ref/default externs obj #f)))
+                count
+                names
+                (reverse includes)))))
+
+    ;; the object a key stored by make-library-image stands for
+    (define (library-image-reference key)
+      (let ((name (cdr key)))
+        (case (car key)
+          ((global) (dictionary-ref (global-objects) name))
+          ((environment) (library-environment name))
+          ((exports) (library-exports name))
+          ((record-type) (if (eq? name 'environment) environment-type identifier-type))
+          (else (error "read-library-image: unknown reference" key)))))
+
+    (define (read-library-image image)
+      (bytevector->object image library-image-reference))
+
+    ;; image is a bytevector or what read-library-image returns for one
+    (define (load-library-image image)
+      (let ((entries (if (bytevector? image) (read-library-image image) image)))
+        (for-each
+         (lambda (entry)
+           (case (car entry)
+             ((library)
+              (apply (lambda (name env exports)
+                       (dictionary-set! *libraries* name `(,env . ,exports)))
+                     (cdr entry)))
+             ((export)
+              (apply dictionary-set! (cdr entry)))
+             ((import)
+              (instantiate-library! (cadr entry)))
+             (else
+              (replay-journal entry))))
+         entries)))
 
 
 
@@ -158,7 +315,10 @@
                       ((rename)
                        (let ((alist (collect (cadr spec)))
                              (renames (map (lambda (x) `(,(car x) . ,(cadr x))) (cddr spec))))
-                         (map (lambda (s) (or (assq (car s) renames) s)) alist)))
+                         (map (lambda (s)
+                                (let ((r (assq (car s) renames)))
+                                  (if r `(,(cdr r) . ,(cdr s)) s)))
+                              alist)))
                       ((prefix)
                        (let ((alist (collect (cadr spec))))
                          (map (lambda (s) (cons (prefix (caddr spec) (car s)) (cdr s))) alist)))
@@ -178,6 +338,7 @@
                      (lambda (spec)
                        (let ((lib (extract spec))
                              (alist (collect spec)))
+                         (journal `(import ,(mangle lib)))
                          (for-each
                           (lambda (slot)
                             (library-import lib (cdr slot) (car slot)))
@@ -231,4 +392,9 @@
             library-environment
             library-exports
             library-import
-            library-export)))
+            library-export
+            make-library-image
+            read-library-image
+            load-library-image
+            library-image-reference
+            add-library-loader!)))
@@ -0,0 +1,31 @@
+/**
+ *                                !!NOTICE!!
+ * This file was automatically generated by mkinit.pl, and includes all of
+ * the prelude files required by Picrin. PLEASE DO NOT EDIT THIS FILE, changes
+ * will be overwritten the next time the script runs.
+ */
+
+#include "picrin.h"
+
+void
+pic_init_contrib(pic_state *pic)
+{
+  void pic_nitro_init_math(pic_state *);
+  void pic_nitro_init_r7rs(pic_state *);
+  void pic_nitro_init_channel(pic_state *);
+  void pic_nitro_init_fiber(pic_state *);
+  void pic_nitro_init_random(pic_state *);
+  void pic_nitro_init_regexp(pic_state *);
+  void pic_nitro_init_srfi_0(pic_state *);
+  void pic_nitro_init_srfi_106(pic_state *);
+  void pic_nitro_init_repl(pic_state *);
+  pic_nitro_init_math(pic);
+  pic_nitro_init_r7rs(pic);
+  pic_nitro_init_channel(pic);
+  pic_nitro_init_fiber(pic);
+  pic_nitro_init_random(pic);
+  pic_nitro_init_regexp(pic);
+  pic_nitro_init_srfi_0(pic);
+  pic_nitro_init_srfi_106(pic);
+  pic_nitro_init_repl(pic);
+}
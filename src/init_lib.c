@@ -0,0 +1,1366 @@
+#include "picrin.h"
+#include "picrin/extra.h"
+
+static const unsigned char lib_rom[] = {
+0x7f, 0x66, 0x73, 0x6c, 0x03, 0x7c, 0x0f, 0x63, 0x75, 0x72, 0x72, 0x65,
+0x6e, 0x74, 0x2d, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0c, 0x66,
+0x69, 0x6e, 0x64, 0x2d, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0c,
+0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79,
+0x13, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2d, 0x65, 0x6e, 0x76,
+0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x0f, 0x6c, 0x69, 0x62,
+0x72, 0x61, 0x72, 0x79, 0x2d, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73,
+0x0e, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2d, 0x69, 0x6d, 0x70,
+0x6f, 0x72, 0x74, 0x0e, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2d,
+0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x12, 0x6d, 0x61, 0x6b, 0x65, 0x2d,
+0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2d, 0x69, 0x6d, 0x61, 0x67,
+0x65, 0x12, 0x72, 0x65, 0x61, 0x64, 0x2d, 0x6c, 0x69, 0x62, 0x72, 0x61,
+0x72, 0x79, 0x2d, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x12, 0x6c, 0x6f, 0x61,
+0x64, 0x2d, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2d, 0x69, 0x6d,
+0x61, 0x67, 0x65, 0x17, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2d,
+0x69, 0x6d, 0x61, 0x67, 0x65, 0x2d, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65,
+0x6e, 0x63, 0x65, 0x13, 0x61, 0x64, 0x64, 0x2d, 0x6c, 0x69, 0x62, 0x72,
+0x61, 0x72, 0x79, 0x2d, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x72, 0x21, 0x10,
+0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x76, 0x61,
+0x6c, 0x75, 0x65, 0x73, 0x04, 0x63, 0x6f, 0x6e, 0x73, 0x04, 0x75, 0x73,
+0x65, 0x72, 0x05, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x05, 0x65, 0x72, 0x72,
+0x6f, 0x72, 0x07, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x0e, 0x73,
+0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2d, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e,
+0x67, 0x0f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x66, 0x6f, 0x72,
+0x2d, 0x65, 0x61, 0x63, 0x68, 0x06, 0x63, 0x68, 0x61, 0x72, 0x3d, 0x3f,
+0x07, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x3f, 0x06, 0x65, 0x78, 0x61,
+0x63, 0x74, 0x3f, 0x02, 0x3c, 0x3d, 0x0e, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+0x72, 0x2d, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x03, 0x63, 0x61,
+0x72, 0x0d, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x61, 0x70, 0x70,
+0x65, 0x6e, 0x64, 0x03, 0x63, 0x64, 0x72, 0x03, 0x6d, 0x61, 0x70, 0x0e,
+0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x3e, 0x73, 0x79, 0x6d, 0x62,
+0x6f, 0x6c, 0x06, 0x70, 0x69, 0x63, 0x72, 0x69, 0x6e, 0x0e, 0x6d, 0x61,
+0x6b, 0x65, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72,
+0x0f, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f,
+0x6e, 0x61, 0x72, 0x79, 0x0f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+0x2d, 0x6a, 0x6f, 0x75, 0x72, 0x6e, 0x61, 0x6c, 0x13, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e,
+0x6d, 0x65, 0x6e, 0x74, 0x08, 0x66, 0x6f, 0x72, 0x2d, 0x65, 0x61, 0x63,
+0x68, 0x0f, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79,
+0x2d, 0x68, 0x61, 0x73, 0x3f, 0x0e, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f,
+0x6e, 0x61, 0x72, 0x79, 0x2d, 0x72, 0x65, 0x66, 0x04, 0x6c, 0x69, 0x73,
+0x74, 0x06, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x0f, 0x64, 0x69, 0x63,
+0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x2d, 0x73, 0x65, 0x74, 0x21,
+0x12, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x2d,
+0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x21, 0x10, 0x6d, 0x61, 0x6b, 0x65,
+0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
+0x0f, 0x73, 0x65, 0x74, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
+0x69, 0x65, 0x72, 0x21, 0x0e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d,
+0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x06, 0x69, 0x6d, 0x70, 0x6f,
+0x72, 0x74, 0x06, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x0b, 0x63, 0x6f,
+0x6e, 0x64, 0x2d, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x07, 0x6c, 0x69,
+0x62, 0x72, 0x61, 0x72, 0x79, 0x0f, 0x66, 0x69, 0x6e, 0x64, 0x2d, 0x69,
+0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x0b, 0x72, 0x65,
+0x63, 0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x0f, 0x6d, 0x61,
+0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
+0x72, 0x01, 0x78, 0x13, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+0x72, 0x79, 0x2d, 0x66, 0x6f, 0x72, 0x2d, 0x65, 0x61, 0x63, 0x68, 0x03,
+0x65, 0x71, 0x3f, 0x0f, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x68, 0x61, 0x73,
+0x68, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0e, 0x67, 0x6c, 0x6f, 0x62,
+0x61, 0x6c, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x0b, 0x65,
+0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x0f, 0x68,
+0x61, 0x73, 0x68, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2d, 0x73, 0x65,
+0x74, 0x21, 0x0a, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
+0x72, 0x1b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79,
+0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f,
+0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x07, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
+0x65, 0x04, 0x63, 0x61, 0x64, 0x72, 0x04, 0x75, 0x6e, 0x69, 0x71, 0x05,
+0x70, 0x61, 0x69, 0x72, 0x3f, 0x08, 0x73, 0x65, 0x74, 0x2d, 0x63, 0x61,
+0x72, 0x21, 0x07, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x12, 0x6f,
+0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x3e, 0x62, 0x79, 0x74, 0x65, 0x76,
+0x65, 0x63, 0x74, 0x6f, 0x72, 0x16, 0x68, 0x61, 0x73, 0x68, 0x2d, 0x74,
+0x61, 0x62, 0x6c, 0x65, 0x2d, 0x72, 0x65, 0x66, 0x2f, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x04, 0x65, 0x71, 0x76, 0x3f, 0x04, 0x6d, 0x65,
+0x6d, 0x71, 0x03, 0x6e, 0x6f, 0x74, 0x07, 0x65, 0x78, 0x70, 0x6f, 0x72,
+0x74, 0x73, 0x06, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x12, 0x62, 0x79,
+0x74, 0x65, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x3e, 0x6f, 0x62,
+0x6a, 0x65, 0x63, 0x74, 0x0b, 0x62, 0x79, 0x74, 0x65, 0x76, 0x65, 0x63,
+0x74, 0x6f, 0x72, 0x3f, 0x05, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x0e, 0x72,
+0x65, 0x70, 0x6c, 0x61, 0x79, 0x2d, 0x6a, 0x6f, 0x75, 0x72, 0x6e, 0x61,
+0x6c, 0x05, 0x6c, 0x69, 0x73, 0x74, 0x3f, 0x06, 0x6c, 0x65, 0x6e, 0x67,
+0x74, 0x68, 0x01, 0x3d, 0x06, 0x72, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x08,
+0x6c, 0x69, 0x73, 0x74, 0x2d, 0x72, 0x65, 0x66, 0x04, 0x6f, 0x6e, 0x6c,
+0x79, 0x06, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x06, 0x65, 0x78, 0x63,
+0x65, 0x70, 0x74, 0x04, 0x63, 0x64, 0x64, 0x72, 0x04, 0x61, 0x73, 0x73,
+0x71, 0x04, 0x63, 0x61, 0x61, 0x72, 0x0e, 0x64, 0x69, 0x63, 0x74, 0x69,
+0x6f, 0x6e, 0x61, 0x72, 0x79, 0x2d, 0x6d, 0x61, 0x70, 0x04, 0x65, 0x6c,
+0x73, 0x65, 0x08, 0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 0x73, 0x03,
+0x61, 0x6e, 0x64, 0x02, 0x6f, 0x72, 0x05, 0x62, 0x65, 0x67, 0x69, 0x6e,
+0x04, 0x63, 0x64, 0x61, 0x72, 0x04, 0x65, 0x76, 0x61, 0x6c, 0x04, 0x62,
+0x61, 0x73, 0x65, 0x12, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d, 0x72,
+0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x0c, 0x70,
+0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x69, 0x7a, 0x65, 0x06,
+0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x04, 0x77, 0x68, 0x65, 0x6e, 0x02,
+0x64, 0x6f, 0x02, 0x3d, 0x3e, 0x04, 0x63, 0x61, 0x73, 0x65, 0x04, 0x63,
+0x6f, 0x6e, 0x64, 0x10, 0x75, 0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x2d,
+0x73, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x6e, 0x67, 0x07, 0x75, 0x6e, 0x71,
+0x75, 0x6f, 0x74, 0x65, 0x0a, 0x71, 0x75, 0x61, 0x73, 0x69, 0x71, 0x75,
+0x6f, 0x74, 0x65, 0x0d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x73, 0x0b, 0x6c, 0x65, 0x74, 0x2a, 0x2d, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x73, 0x0a, 0x6c, 0x65, 0x74, 0x2d, 0x76, 0x61,
+0x6c, 0x75, 0x65, 0x73, 0x07, 0x6c, 0x65, 0x74, 0x72, 0x65, 0x63, 0x2a,
+0x06, 0x6c, 0x65, 0x74, 0x72, 0x65, 0x63, 0x04, 0x6c, 0x65, 0x74, 0x2a,
+0x03, 0x6c, 0x65, 0x74, 0x0c, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d,
+0x6d, 0x61, 0x63, 0x72, 0x6f, 0x02, 0x69, 0x66, 0x04, 0x73, 0x65, 0x74,
+0x21, 0x05, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x06, 0x6c, 0x61, 0x6d, 0x62,
+0x64, 0x61, 0x06, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x06, 0x76, 0x61,
+0x6c, 0x75, 0x65, 0x73, 0x0d, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x2d, 0x6f,
+0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x13, 0x11, 0x01, 0x00, 0x05, 0x0d,
+0x02, 0x4b, 0x0a, 0x00, 0x0a, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04,
+0x0a, 0x05, 0x0a, 0x06, 0x0a, 0x07, 0x0a, 0x08, 0x0a, 0x09, 0x0a, 0x0a,
+0x0a, 0x0b, 0x0a, 0x0c, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x07,
+0x00, 0x01, 0x0c, 0x00, 0x07, 0x00, 0x02, 0x0c, 0x00, 0x07, 0x00, 0x03,
+0x0c, 0x00, 0x07, 0x00, 0x04, 0x0c, 0x00, 0x07, 0x00, 0x05, 0x0c, 0x00,
+0x07, 0x00, 0x06, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x0c, 0x00, 0x07, 0x00,
+0x08, 0x0c, 0x00, 0x07, 0x00, 0x09, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x0c,
+0x00, 0x07, 0x00, 0x0b, 0x06, 0x00, 0x0c, 0x04, 0x01, 0x00, 0x01, 0x02,
+0x02, 0x00, 0x02, 0x03, 0x01, 0x01, 0x03, 0x1a, 0x88, 0x73, 0x11, 0x01,
+0x00, 0x03, 0x00, 0x01, 0x09, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+0x01, 0x01, 0x1a, 0xf5, 0x72, 0x11, 0x01, 0x00, 0x17, 0x00, 0x01, 0x31,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a,
+0x04, 0x0a, 0x05, 0x0a, 0x06, 0x0a, 0x07, 0x0a, 0x08, 0x0a, 0x09, 0x0a,
+0x0a, 0x0a, 0x0b, 0x0a, 0x0c, 0x0a, 0x0d, 0x0a, 0x0e, 0x0a, 0x0f, 0x0a,
+0x10, 0x0a, 0x11, 0x0a, 0x12, 0x0a, 0x13, 0x0a, 0x14, 0x0a, 0x15, 0x01,
+0x15, 0x1a, 0xba, 0x72, 0x11, 0x15, 0x00, 0x05, 0x02, 0x02, 0x14, 0x0a,
+0x0d, 0x0a, 0x0e, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x15, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x1a,
+0xf7, 0x08, 0x11, 0x02, 0x00, 0x05, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x01, 0x03, 0x1a, 0xe0,
+0x08, 0x11, 0x03, 0x00, 0x03, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x01, 0x01, 0x1a, 0x77, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x0a, 0x0f, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
+0x02, 0x01, 0x02, 0x1a, 0x60, 0x11, 0x01, 0x00, 0x05, 0x02, 0x00, 0x20,
+0x0a, 0x10, 0x08, 0x35, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20,
+0x6e, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20,
+0x62, 0x65, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66,
+0x20, 0x61, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x6f, 0x6e,
+0x65, 0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x73, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x04, 0x00, 0x01,
+0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0xd5, 0x07, 0x11, 0x01, 0x00, 0x04,
+0x01, 0x03, 0x1a, 0x0a, 0x11, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01, 0x03,
+0x02, 0x00, 0x01, 0x05, 0x00, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x1a, 0xc3, 0x04, 0x11, 0x02,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x11, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xab, 0x04, 0x11, 0x01,
+0x00, 0x04, 0x01, 0x03, 0x1c, 0x0a, 0x12, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x02, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x1a,
+0xbc, 0x02, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xa5,
+0x02, 0x11, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a, 0x13, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x02, 0x01,
+0x03, 0x1a, 0x11, 0x11, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x00,
+0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x1a, 0xf7, 0x01, 0x11,
+0x02, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x14, 0x07, 0x2e, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01,
+0x03, 0x1a, 0xda, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0x65, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01, 0x21, 0x0a, 0x14, 0x07, 0x3a,
+0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0x37, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00,
+0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00,
+0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x5e, 0x11, 0x01, 0x00, 0x05,
+0x02, 0x00, 0x20, 0x0a, 0x10, 0x08, 0x33, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61,
+0x72, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6d, 0x61, 0x79, 0x20,
+0x6e, 0x6f, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x20,
+0x27, 0x2e, 0x27, 0x20, 0x6f, 0x72, 0x20, 0x27, 0x3a, 0x27, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02,
+0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x06, 0x02, 0x01, 0x03, 0x04, 0x00,
+0x02, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0x67, 0x11, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x0a, 0x15, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x01, 0x02, 0x1a, 0x50, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x1c, 0x0a, 0x16, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02,
+0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x29, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x20, 0x0a, 0x17, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x0d, 0x02,
+0x00, 0x04, 0x03, 0x04, 0x02, 0x01, 0x03, 0x04, 0x00, 0x02, 0x01, 0x0a,
+0x01, 0x01, 0x01, 0x1a, 0x5c, 0x11, 0x01, 0x00, 0x05, 0x03, 0x00, 0x25,
+0x0a, 0x18, 0x0a, 0x10, 0x08, 0x2a, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
+0x20, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x6e, 0x65, 0x67, 0x61,
+0x74, 0x69, 0x76, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x02, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01,
+0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x01,
+0x03, 0x1a, 0x88, 0x02, 0x11, 0x03, 0x00, 0x03, 0x00, 0x01, 0x09, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x1a, 0xf5, 0x01, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0b, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00,
+0x01, 0x0a, 0x02, 0x01, 0x02, 0x1a, 0xe0, 0x01, 0x11, 0x02, 0x00, 0x04,
+0x01, 0x02, 0x13, 0x0a, 0x19, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02,
+0x1a, 0x8f, 0x01, 0x11, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x0f,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x01, 0x02,
+0x1a, 0x78, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1e, 0x0a, 0x19, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04,
+0x01, 0x01, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x01, 0x03, 0x01, 0x02, 0x1a, 0x4f, 0x11, 0x01, 0x00, 0x06, 0x01,
+0x01, 0x14, 0x0a, 0x1a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x02, 0x04, 0x03, 0x05, 0x03, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04,
+0x1a, 0x30, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x1b, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x1a,
+0x19, 0x11, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x04, 0x00, 0x05, 0x02,
+0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x1a, 0x30, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a,
+0x1b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01,
+0x02, 0x1a, 0x19, 0x11, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x04, 0x00,
+0x02, 0x02, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x1a, 0x5f, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x22, 0x0a, 0x1c, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0e, 0x00, 0x04,
+0x00, 0x02, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x02, 0x01,
+0x03, 0x1a, 0x32, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x08, 0x01,
+0x2e, 0x04, 0x00, 0x03, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x03, 0x03, 0x00, 0x01, 0x03, 0x1a, 0x16, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x00, 0x0d, 0x0a, 0x1d, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x9e, 0x69, 0x11, 0x01, 0x00, 0x05,
+0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x1e, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x81,
+0x69, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x1f, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x02, 0x15,
+0x01, 0x03, 0x1a, 0xe5, 0x68, 0x11, 0x01, 0x00, 0x03, 0x01, 0x01, 0x10,
+0x0a, 0x20, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x03, 0x14, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0xc9, 0x68, 0x11, 0x01, 0x00,
+0x03, 0x01, 0x02, 0x17, 0x0a, 0x20, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00,
+0x04, 0x13, 0x02, 0x00, 0x00, 0x05, 0x00, 0x04, 0x12, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x4e, 0x11, 0x02, 0x00, 0x03, 0x01,
+0x01, 0x08, 0x0a, 0x21, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x1a, 0x3b, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x25,
+0x11, 0x02, 0x00, 0x04, 0x00, 0x00, 0x1e, 0x04, 0x00, 0x00, 0x02, 0x08,
+0x00, 0x12, 0x00, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x04,
+0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x01,
+0x01, 0x1a, 0xd6, 0x67, 0x11, 0x01, 0x00, 0x03, 0x01, 0x09, 0x48, 0x0a,
+0x22, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x05, 0x11, 0x02, 0x00, 0x00,
+0x05, 0x00, 0x05, 0x10, 0x02, 0x00, 0x01, 0x05, 0x00, 0x05, 0x0f, 0x02,
+0x00, 0x02, 0x05, 0x00, 0x05, 0x0e, 0x02, 0x00, 0x03, 0x05, 0x00, 0x05,
+0x0d, 0x02, 0x00, 0x04, 0x05, 0x00, 0x05, 0x0c, 0x02, 0x00, 0x05, 0x05,
+0x00, 0x05, 0x0b, 0x02, 0x00, 0x06, 0x05, 0x00, 0x05, 0x0a, 0x02, 0x00,
+0x07, 0x05, 0x00, 0x05, 0x09, 0x06, 0x00, 0x00, 0x02, 0x01, 0x08, 0x01,
+0x01, 0x1a, 0xdf, 0x02, 0x11, 0x03, 0x00, 0x04, 0x00, 0x02, 0x0a, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x1a, 0x39, 0x11,
+0x02, 0x00, 0x03, 0x00, 0x01, 0x09, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01,
+0x00, 0x01, 0x01, 0x1a, 0x27, 0x11, 0x01, 0x00, 0x03, 0x00, 0x00, 0x20,
+0x04, 0x00, 0x01, 0x02, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x0c, 0x01, 0x01, 0x01, 0x09, 0x00, 0x05, 0x00, 0x01, 0x02, 0x04, 0x00,
+0x02, 0x03, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x1a, 0x90, 0x02, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xf9, 0x01, 0x11, 0x02,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x23, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x00, 0x01, 0x02, 0x02, 0x00, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x1a,
+0xdd, 0x01, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x09,
+0x15, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xc6,
+0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xaf, 0x01,
+0x11, 0x02, 0x00, 0x03, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x01, 0x01, 0x1a, 0x7e, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x0a, 0x24, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x11,
+0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x1a, 0x63, 0x11, 0x01, 0x00, 0x05,
+0x02, 0x01, 0x25, 0x0a, 0x25, 0x0a, 0x26, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d,
+0x11, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x06, 0x00, 0x01, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x1a, 0x31, 0x11, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x26, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x1a, 0x1a, 0x11, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x0a, 0x27, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03,
+0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0x1e, 0x11, 0x01, 0x00, 0x06, 0x01, 0x00, 0x15, 0x0a, 0x28, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x0c, 0x11, 0x04, 0x03, 0x01,
+0x02, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x1a, 0xa4, 0x01, 0x11, 0x02,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x24, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x06, 0x11, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x1a,
+0x88, 0x01, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x20, 0x0a, 0x25, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x07, 0x11, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x04,
+0x00, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0x5d, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x47, 0x11, 0x02, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x0a, 0x29, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x09, 0x11, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x2c, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x23, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x1a,
+0x11, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x02,
+0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x1a, 0xc3, 0x01, 0x11, 0x02, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x06, 0x15, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xac, 0x01, 0x11, 0x01, 0x00, 0x04,
+0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0x95, 0x01, 0x11, 0x02, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x0a, 0x24, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x08, 0x13, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x1a, 0x7a, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x64, 0x11, 0x02, 0x00, 0x05,
+0x01, 0x01, 0x22, 0x0a, 0x24, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x11, 0x04, 0x03, 0x02,
+0x02, 0x01, 0x03, 0x1a, 0x37, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x1a, 0x87, 0x04, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00,
+0x06, 0x15, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a,
+0xf0, 0x03, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xd9,
+0x03, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x12, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xc1,
+0x03, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x1a, 0x08, 0x01,
+0x3a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x03,
+0x03, 0x01, 0x01, 0x03, 0x1a, 0xa3, 0x03, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x0a, 0x1d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0x8b, 0x03, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x0a, 0x2a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0xf3, 0x02, 0x11, 0x01, 0x00, 0x03, 0x01,
+0x01, 0x08, 0x0a, 0x20, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x1a, 0xdf, 0x02, 0x11, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0xc4, 0x02, 0x11, 0x03, 0x00, 0x06, 0x03, 0x01,
+0x12, 0x0a, 0x2b, 0x0a, 0x2c, 0x0a, 0x2c, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x04, 0x00, 0x02, 0x01,
+0x04, 0x1a, 0xa2, 0x02, 0x11, 0x01, 0x00, 0x06, 0x03, 0x01, 0x12, 0x0a,
+0x2b, 0x0a, 0x2d, 0x0a, 0x2d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x04, 0x01, 0x02, 0x01, 0x04, 0x1a,
+0x80, 0x02, 0x11, 0x01, 0x00, 0x06, 0x03, 0x01, 0x12, 0x0a, 0x2b, 0x0a,
+0x2e, 0x0a, 0x2e, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x03, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x01, 0x04, 0x1a, 0xde, 0x01,
+0x11, 0x01, 0x00, 0x06, 0x03, 0x01, 0x12, 0x0a, 0x2b, 0x0a, 0x2f, 0x0a,
+0x2f, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x03,
+0x02, 0x04, 0x04, 0x03, 0x02, 0x01, 0x04, 0x1a, 0xbc, 0x01, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x04, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x1a, 0xa2, 0x01,
+0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x0d, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x1a, 0x86, 0x01, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a,
+0x0d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x02, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x6b, 0x11, 0x01, 0x00, 0x05, 0x02,
+0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x30, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x4f, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x16, 0x12, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x39, 0x11, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x09, 0x02, 0x04, 0x03, 0x09, 0x03, 0x01, 0x03, 0x1a, 0x1e,
+0x11, 0x01, 0x00, 0x06, 0x01, 0x00, 0x15, 0x0a, 0x28, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x0a, 0x01, 0x04, 0x02, 0x18, 0x13, 0x04, 0x03, 0x10, 0x02,
+0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x1a, 0x73, 0x11, 0x02, 0x00, 0x04,
+0x00, 0x01, 0x0d, 0x04, 0x00, 0x06, 0x15, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x1a, 0x5d, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01,
+0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x1a, 0x47, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04,
+0x00, 0x08, 0x0f, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x1a, 0x31, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x25, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x13, 0x04, 0x03, 0x01,
+0x02, 0x01, 0x03, 0x1a, 0x16, 0x11, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x0a, 0x19, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x1a, 0x73, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x04, 0x00, 0x06, 0x15, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
+0x02, 0x1a, 0x5d, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0x47, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x08, 0x0f,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0x31, 0x11,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x25, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x09, 0x13, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03,
+0x1a, 0x16, 0x11, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x0a, 0x1b, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x1a, 0xa4, 0x01, 0x11, 0x04, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00,
+0x06, 0x0b, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a,
+0x8d, 0x01, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x25, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x01,
+0x03, 0x01, 0x03, 0x1a, 0x72, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x5c, 0x11, 0x02, 0x00, 0x03, 0x00, 0x01, 0x09, 0x04, 0x00,
+0x09, 0x14, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0x4a, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x0a, 0x0c, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x34, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x1a, 0x1e, 0x11, 0x02, 0x00, 0x06, 0x01, 0x00, 0x15,
+0x0a, 0x2b, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x06,
+0x04, 0x04, 0x03, 0x03, 0x02, 0x04, 0x04, 0x00, 0x02, 0x01, 0x04, 0x1a,
+0xc2, 0x02, 0x11, 0x03, 0x00, 0x03, 0x00, 0x01, 0x09, 0x04, 0x00, 0x06,
+0x14, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0xaf, 0x02, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x07, 0x0c, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x98, 0x02, 0x11, 0x01, 0x00, 0x03,
+0x00, 0x01, 0x09, 0x04, 0x00, 0x08, 0x14, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x1a, 0x85, 0x02, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00,
+0x09, 0x0b, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0xee, 0x01, 0x11, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x1a, 0xd3, 0x01, 0x11, 0x03, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x0a, 0x31, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02,
+0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x1a, 0xb7, 0x01, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xa0, 0x01, 0x11, 0x02, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x1a, 0x86, 0x01, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x08, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0x6b, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x0d, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x03, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x1a, 0x50, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a,
+0x0d, 0x0a, 0x2e, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x34, 0x11, 0x01, 0x00, 0x04,
+0x00, 0x01, 0x0d, 0x04, 0x00, 0x11, 0x12, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0x1e, 0x11, 0x01, 0x00, 0x06, 0x01, 0x00,
+0x15, 0x0a, 0x28, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02,
+0x07, 0x03, 0x04, 0x03, 0x0c, 0x03, 0x04, 0x04, 0x05, 0x02, 0x01, 0x04,
+0x1a, 0xd3, 0x57, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x32,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x1a, 0xbb, 0x57, 0x11, 0x01, 0x00, 0x03, 0x01, 0x01, 0x10, 0x0a, 0x22,
+0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x07, 0x08, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x01, 0x01, 0x1a, 0x9f, 0x57, 0x11, 0x01, 0x00, 0x05, 0x02,
+0x01, 0x0f, 0x0a, 0x33, 0x0a, 0x34, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x82, 0x57,
+0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x32, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xea, 0x56,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x08, 0x36, 0x04, 0x00, 0x00, 0x01, 0x05,
+0x00, 0x0a, 0x07, 0x02, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x06, 0x02, 0x00,
+0x01, 0x05, 0x00, 0x0a, 0x05, 0x02, 0x00, 0x02, 0x05, 0x00, 0x0a, 0x04,
+0x02, 0x00, 0x03, 0x05, 0x00, 0x0a, 0x03, 0x02, 0x00, 0x04, 0x05, 0x00,
+0x0a, 0x02, 0x02, 0x00, 0x05, 0x02, 0x01, 0x06, 0x02, 0x02, 0x07, 0x01,
+0x02, 0x1a, 0xb6, 0x01, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0b, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x1a, 0xa1,
+0x01, 0x11, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a, 0x35, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x0c, 0x13, 0x01,
+0x03, 0x1a, 0x11, 0x11, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x00,
+0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x1a, 0x74, 0x11, 0x02,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x25, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x0d, 0x13, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x1a,
+0x59, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x1b, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x42,
+0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x36, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x04, 0x02, 0x01,
+0x03, 0x1a, 0x27, 0x11, 0x01, 0x00, 0x03, 0x00, 0x00, 0x20, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x14, 0x00, 0x04, 0x00, 0x03, 0x02, 0x05, 0x00,
+0x04, 0x02, 0x04, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x04, 0x00,
+0x03, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0xbc, 0x0f, 0x11, 0x02, 0x00,
+0x04, 0x02, 0x01, 0x0b, 0x0a, 0x37, 0x0a, 0x36, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x06, 0x02, 0x01, 0x01, 0x02, 0x1a, 0xa3, 0x0f, 0x11, 0x01,
+0x00, 0x06, 0x00, 0x01, 0x11, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x0b, 0x04, 0x01, 0x04, 0x1a, 0x88,
+0x0f, 0x11, 0x04, 0x00, 0x03, 0x01, 0x01, 0x08, 0x0a, 0x38, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0xf4, 0x0e, 0x11, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x0a, 0x35, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xef, 0x0d,
+0x11, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a, 0x35, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x0f, 0x13, 0x01, 0x03,
+0x1a, 0xfa, 0x0b, 0x11, 0x01, 0x00, 0x05, 0x03, 0x01, 0x0e, 0x0a, 0x0d,
+0x0a, 0x32, 0x0a, 0x39, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0xdc, 0x0b, 0x11, 0x01, 0x00,
+0x06, 0x01, 0x01, 0x14, 0x0a, 0x3a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x11, 0x08, 0x04, 0x04, 0x00, 0x01,
+0x01, 0x04, 0x1a, 0xbc, 0x0b, 0x11, 0x01, 0x00, 0x05, 0x03, 0x01, 0x0e,
+0x0a, 0x0d, 0x0a, 0x32, 0x0a, 0x3b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x9e, 0x0b, 0x11,
+0x01, 0x00, 0x06, 0x01, 0x01, 0x14, 0x0a, 0x3a, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x04, 0x03, 0x13, 0x07, 0x04, 0x04,
+0x00, 0x01, 0x01, 0x04, 0x1a, 0xfe, 0x0a, 0x11, 0x01, 0x00, 0x03, 0x01,
+0x01, 0x08, 0x0a, 0x3c, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x1a, 0xea, 0x0a, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xfe,
+0x03, 0x11, 0x02, 0x00, 0x04, 0x01, 0x02, 0x0b, 0x0a, 0x21, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x01, 0x02, 0x1a, 0x50, 0x11,
+0x01, 0x00, 0x03, 0x00, 0x01, 0x09, 0x04, 0x00, 0x0c, 0x02, 0x02, 0x01,
+0x00, 0x01, 0x01, 0x1a, 0x3e, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x28, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x3c,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02,
+0x1a, 0x11, 0x11, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x01,
+0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x1a, 0x95, 0x03, 0x11, 0x02,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xfd, 0x02, 0x11, 0x01,
+0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x36, 0x0a, 0x3d, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03,
+0x1a, 0xe0, 0x02, 0x11, 0x01, 0x00, 0x04, 0x01, 0x03, 0x1c, 0x0a, 0x3e,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02,
+0x01, 0x02, 0x01, 0x01, 0x1a, 0x32, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x04, 0x03, 0x0d, 0x04, 0x01, 0x03, 0x1a, 0x17, 0x11, 0x01, 0x00,
+0x03, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x0e, 0x04,
+0x04, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0xb5, 0x01, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a, 0x9d, 0x01, 0x11,
+0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x36, 0x0a, 0x3f, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0x01,
+0x03, 0x1a, 0x80, 0x01, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a,
+0x40, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x03, 0x01, 0x02, 0x04, 0x00, 0x02,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x59, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x1c, 0x0a, 0x19, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x03, 0x01, 0x02,
+0x04, 0x00, 0x03, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x32, 0x11, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x1b, 0x11, 0x01, 0x00,
+0x05, 0x02, 0x00, 0x10, 0x0a, 0x36, 0x0a, 0x3f, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03,
+0x1a, 0x4d, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x29, 0x0a, 0x41, 0x0a,
+0x0d, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x15, 0x00, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x0d, 0x03, 0x04, 0x03, 0x03, 0x02,
+0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02,
+0x04, 0x03, 0x0d, 0x03, 0x01, 0x03, 0x1a, 0x17, 0x11, 0x01, 0x00, 0x03,
+0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x0e, 0x03, 0x04,
+0x00, 0x04, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0xd3, 0x06, 0x11, 0x01,
+0x00, 0x05, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x09, 0x01,
+0x0a, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x1a, 0xbc, 0x06, 0x11, 0x03, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x0a, 0x23, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x02, 0x02, 0x01, 0x04, 0x03, 0x0a, 0x03, 0x01, 0x03, 0x1a, 0x88, 0x01,
+0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x42, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x0b, 0x03, 0x01, 0x02, 0x1a, 0x71, 0x11,
+0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a, 0x43, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x1a,
+0x39, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x42, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x04, 0x01, 0x02, 0x1a, 0x22,
+0x11, 0x01, 0x00, 0x07, 0x01, 0x00, 0x19, 0x0a, 0x26, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x04, 0x02,
+0x04, 0x04, 0x04, 0x03, 0x04, 0x05, 0x00, 0x01, 0x01, 0x05, 0x1a, 0x1c,
+0x11, 0x02, 0x00, 0x06, 0x01, 0x00, 0x13, 0x0a, 0x44, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x0d, 0x02, 0x04, 0x03, 0x00, 0x02,
+0x0a, 0x04, 0x01, 0x04, 0x1a, 0x96, 0x05, 0x11, 0x02, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x1a, 0xfe, 0x04, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x1a, 0x8c, 0x02, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01, 0x0f,
+0x0a, 0x45, 0x0a, 0x30, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0xef, 0x01, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00,
+0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x1a, 0xb6, 0x01, 0x11, 0x01, 0x00, 0x05, 0x03,
+0x01, 0x24, 0x0a, 0x3e, 0x0a, 0x45, 0x0a, 0x2e, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
+0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x82, 0x01, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03,
+0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x4a, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x2a, 0x0a, 0x3e, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02,
+0x09, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x04, 0x01, 0x0a, 0x01,
+0x01, 0x01, 0x04, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0x15,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x1f, 0x06, 0x04,
+0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xd9, 0x02,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x96, 0x01, 0x11, 0x02,
+0x00, 0x03, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01,
+0x01, 0x1a, 0x41, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x20, 0x0a, 0x46,
+0x04, 0x00, 0x01, 0x02, 0x08, 0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x05, 0x03, 0x01, 0x03,
+0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x16, 0x11, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x0a, 0x47, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x42, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x20, 0x0a, 0x0d, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x02, 0x04, 0x03, 0x05, 0x03, 0x01, 0x03, 0x04, 0x00, 0x01, 0x01, 0x0c,
+0x01, 0x01, 0x01, 0x1a, 0x17, 0x11, 0x01, 0x00, 0x03, 0x00, 0x00, 0x10,
+0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x06, 0x03, 0x04, 0x00, 0x02, 0x01,
+0x0c, 0x01, 0x01, 0x01, 0x1a, 0xaa, 0x01, 0x11, 0x01, 0x00, 0x03, 0x00,
+0x02, 0x08, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x59,
+0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x47, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x1a, 0x42, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a, 0x19, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x05, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x1a, 0x1b, 0x11, 0x01, 0x00, 0x05, 0x02, 0x00, 0x10, 0x0a, 0x36, 0x0a,
+0x3f, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0x3e, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x1c, 0x0a, 0x3e, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
+0x04, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0x17, 0x11, 0x01,
+0x00, 0x03, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x06,
+0x02, 0x04, 0x00, 0x05, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0xd7, 0x01,
+0x11, 0x02, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x25, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x13, 0x04, 0x03, 0x00, 0x02, 0x01,
+0x03, 0x1a, 0xbb, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x1a, 0xa4, 0x01, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x1a, 0x8c, 0x01, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d,
+0x0a, 0x39, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x70, 0x11, 0x01, 0x00, 0x06, 0x01,
+0x01, 0x14, 0x0a, 0x3a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x07, 0x02, 0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04,
+0x1a, 0x51, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x1b, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a,
+0x3a, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x48,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x06,
+0x02, 0x01, 0x03, 0x1a, 0x1e, 0x11, 0x01, 0x00, 0x06, 0x01, 0x00, 0x15,
+0x0a, 0x3a, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x0a,
+0x02, 0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x1a,
+0x68, 0x11, 0x02, 0x00, 0x03, 0x01, 0x01, 0x08, 0x0a, 0x38, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0x55, 0x11, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x0a, 0x25, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x1a, 0x3a, 0x11,
+0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x49, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x02, 0x02, 0x01,
+0x03, 0x1a, 0x1e, 0x11, 0x01, 0x00, 0x06, 0x01, 0x00, 0x15, 0x0a, 0x3a,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x05, 0x02, 0x04,
+0x03, 0x01, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x1a, 0x9e, 0x05,
+0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x1b, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0x86, 0x05,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xef, 0x04, 0x11,
+0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x1a, 0xd7, 0x04, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xc0, 0x04, 0x11, 0x02,
+0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x45, 0x0a, 0x49, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03,
+0x1a, 0xa3, 0x04, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21,
+0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08,
+0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0xea, 0x03,
+0x11, 0x01, 0x00, 0x05, 0x03, 0x02, 0x1f, 0x0a, 0x38, 0x0a, 0x45, 0x0a,
+0x39, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x01, 0x01, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x1a, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x25, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x05, 0x02, 0x01, 0x03,
+0x1a, 0x9f, 0x03, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21,
+0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08,
+0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0xe6, 0x02,
+0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x25, 0x0a, 0x45, 0x0a, 0x48, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x04, 0x00, 0x13, 0x0c, 0x04,
+0x01, 0x04, 0x01, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03,
+0x1a, 0xb3, 0x02, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21,
+0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08,
+0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0xfa, 0x01,
+0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x25, 0x0a, 0x45, 0x0a, 0x32, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x04, 0x00, 0x15, 0x0b, 0x04,
+0x01, 0x06, 0x01, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03,
+0x1a, 0xc7, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21,
+0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08,
+0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x8e, 0x01,
+0x11, 0x01, 0x00, 0x05, 0x04, 0x01, 0x35, 0x0a, 0x36, 0x0a, 0x39, 0x0a,
+0x10, 0x08, 0x25, 0x72, 0x65, 0x61, 0x64, 0x2d, 0x6c, 0x69, 0x62, 0x72,
+0x61, 0x72, 0x79, 0x2d, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x75,
+0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72,
+0x65, 0x6e, 0x63, 0x65, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x13, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x03, 0x03,
+0x01, 0x01, 0x03, 0x09, 0x00, 0x08, 0x00, 0x14, 0x00, 0x06, 0x00, 0x02,
+0x04, 0x01, 0x08, 0x01, 0x03, 0x02, 0x03, 0x04, 0x03, 0x0c, 0x02, 0x01,
+0x03, 0x04, 0x00, 0x08, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0x23, 0x11,
+0x01, 0x00, 0x03, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x09, 0x01, 0x04, 0x01, 0x18, 0x08, 0x01, 0x01,
+0x04, 0x00, 0x09, 0x01, 0x04, 0x01, 0x18, 0x07, 0x01, 0x01, 0x1a, 0x1a,
+0x11, 0x02, 0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x4a, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x0b, 0x04,
+0x01, 0x03, 0x1a, 0xa5, 0x05, 0x11, 0x02, 0x00, 0x03, 0x00, 0x02, 0x08,
+0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x3e, 0x11, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x4b, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x1a, 0x27, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00,
+0x04, 0x00, 0x0d, 0x03, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02,
+0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x02, 0x02, 0x01, 0x01,
+0x1a, 0xd3, 0x04, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0xbc, 0x04, 0x11, 0x02, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x23, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x04, 0x03, 0x00,
+0x02, 0x01, 0x03, 0x1a, 0xa0, 0x04, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x02, 0x01, 0x02, 0x1a, 0x88, 0x04, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01,
+0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x1a, 0xf1, 0x03, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01, 0x0f,
+0x0a, 0x45, 0x0a, 0x30, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0xd4, 0x03, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00,
+0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x1a, 0x9b, 0x03, 0x11, 0x01, 0x00, 0x05, 0x03,
+0x02, 0x23, 0x0a, 0x1b, 0x0a, 0x45, 0x0a, 0x2e, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x54, 0x11, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x0a, 0x4c, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03,
+0x01, 0x02, 0x02, 0x00, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x39,
+0x11, 0x04, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x0d, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x04, 0x03, 0x00, 0x04, 0x01,
+0x03, 0x1a, 0x1e, 0x11, 0x01, 0x00, 0x06, 0x01, 0x00, 0x15, 0x0a, 0x28,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x15, 0x13, 0x04,
+0x03, 0x01, 0x02, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x1a, 0x92, 0x02,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00,
+0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00,
+0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0xd9, 0x01, 0x11, 0x01, 0x00,
+0x05, 0x03, 0x02, 0x23, 0x0a, 0x1b, 0x0a, 0x45, 0x0a, 0x2d, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x1b, 0x11,
+0x01, 0x00, 0x05, 0x02, 0x00, 0x10, 0x0a, 0x4c, 0x0a, 0x28, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x05, 0x01, 0x06, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x1a, 0x89, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c,
+0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00,
+0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a,
+0x51, 0x11, 0x01, 0x00, 0x04, 0x02, 0x01, 0x2f, 0x0a, 0x3e, 0x0a, 0x4d,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x09, 0x00, 0x08, 0x00,
+0x11, 0x00, 0x06, 0x00, 0x01, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x08,
+0x02, 0x01, 0x02, 0x04, 0x00, 0x06, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a,
+0x15, 0x11, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x17, 0x0f,
+0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xcf,
+0x2e, 0x11, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a, 0x2c, 0x04, 0x00,
+0x00, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x02, 0x03, 0x01, 0x01,
+0x03, 0x1a, 0xa9, 0x29, 0x11, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a,
+0x2f, 0x04, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x02,
+0x03, 0x01, 0x01, 0x03, 0x1a, 0x9d, 0x1a, 0x11, 0x01, 0x00, 0x05, 0x01,
+0x02, 0x0f, 0x0a, 0x2d, 0x04, 0x00, 0x02, 0x02, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x00, 0x02, 0x03, 0x01, 0x01, 0x03, 0x1a, 0xc2, 0x04, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x2e, 0x04, 0x00, 0x03, 0x02, 0x04,
+0x01, 0x03, 0x01, 0x03, 0x02, 0x00, 0x02, 0x03, 0x00, 0x01, 0x03, 0x1a,
+0xa6, 0x04, 0x11, 0x03, 0x00, 0x05, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x00, 0x01, 0x0c, 0x02, 0x0c, 0x03, 0x01, 0x03, 0x1a, 0x8f,
+0x04, 0x11, 0x03, 0x00, 0x04, 0x01, 0x03, 0x1a, 0x0a, 0x1b, 0x02, 0x00,
+0x00, 0x05, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x03,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
+0x1a, 0xd8, 0x02, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x11,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x1a, 0xc0, 0x02, 0x11, 0x01, 0x00, 0x05, 0x01, 0x02, 0x21, 0x0a, 0x0d,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x15, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01,
+0x03, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x9b, 0x01,
+0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x4e, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x1a, 0x83, 0x01,
+0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a, 0x4f, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01,
+0x01, 0x1a, 0x5c, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x0a, 0x50,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03,
+0x03, 0x01, 0x03, 0x1a, 0x42, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c,
+0x0a, 0x19, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x04, 0x00,
+0x03, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x1b, 0x11, 0x01, 0x00, 0x05,
+0x02, 0x00, 0x10, 0x0a, 0x36, 0x0a, 0x51, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a,
+0x76, 0x11, 0x01, 0x00, 0x05, 0x03, 0x01, 0x23, 0x0a, 0x52, 0x0a, 0x10,
+0x08, 0x10, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20,
+0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
+0x0d, 0x03, 0x01, 0x01, 0x03, 0x06, 0x00, 0x01, 0x04, 0x01, 0x02, 0x01,
+0x03, 0x02, 0x02, 0x01, 0x02, 0x1a, 0x34, 0x11, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0f, 0x0a, 0x52, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x03, 0x02, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x1a, 0x11, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04,
+0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0x73, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x01, 0x02,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0x5d, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x47, 0x11, 0x02, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0x30, 0x11, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x0a, 0x1b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x01, 0x02, 0x01, 0x02, 0x1a, 0x19, 0x11, 0x01, 0x00, 0x05, 0x00,
+0x00, 0x12, 0x04, 0x00, 0x15, 0x09, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02,
+0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x1a, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x23, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x1a, 0xbd, 0x15, 0x11, 0x03, 0x00, 0x06, 0x00, 0x04, 0x12, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x00, 0x01, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02,
+0x04, 0x03, 0x01, 0x04, 0x1a, 0xa4, 0x13, 0x11, 0x04, 0x00, 0x05, 0x00,
+0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0c, 0x02, 0x0c,
+0x03, 0x01, 0x03, 0x1a, 0x8d, 0x13, 0x11, 0x03, 0x00, 0x04, 0x00, 0x03,
+0x19, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x05,
+0x00, 0x00, 0x03, 0x02, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x0c, 0x02,
+0x01, 0x02, 0x1a, 0xa3, 0x03, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
+0x01, 0x02, 0x1a, 0x8b, 0x03, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0xf4, 0x02, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a,
+0x45, 0x0a, 0x53, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0xd7, 0x02, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0xef, 0x01, 0x11, 0x02, 0x00, 0x05, 0x02,
+0x01, 0x21, 0x0a, 0x45, 0x0a, 0x51, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03,
+0x01, 0x01, 0x03, 0x1a, 0xc0, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01,
+0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x1a, 0xa9, 0x01, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01, 0x21,
+0x0a, 0x45, 0x0a, 0x54, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01,
+0x03, 0x1a, 0x7b, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0x65, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01, 0x21, 0x0a, 0x45, 0x0a, 0x55,
+0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x06, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0x37, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00,
+0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00,
+0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x50, 0x11, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x30, 0x0a, 0x3e, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
+0x02, 0x09, 0x00, 0x08, 0x00, 0x12, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04,
+0x01, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x02,
+0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0x15, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x00, 0x0e, 0x04, 0x00, 0x06, 0x02, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0xf4, 0x0c, 0x11, 0x02, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x1a, 0xdc, 0x0c, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x1a, 0xc5, 0x0c, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01,
+0x0f, 0x0a, 0x45, 0x0a, 0x53, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0xa8, 0x0c, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03,
+0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0xef, 0x0b, 0x11, 0x01, 0x00, 0x05,
+0x03, 0x02, 0x23, 0x0a, 0x3e, 0x0a, 0x45, 0x0a, 0x51, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0x78, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x06, 0x03, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x62, 0x11, 0x01, 0x00, 0x04,
+0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0x4c, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x0a, 0x56, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07,
+0x02, 0x01, 0x02, 0x1a, 0x35, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x0a, 0x1c, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x1a, 0x11, 0x02, 0x00, 0x05,
+0x01, 0x00, 0x11, 0x0a, 0x57, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x1a, 0xc2,
+0x0a, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02,
+0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x89, 0x0a, 0x11, 0x01,
+0x00, 0x05, 0x03, 0x02, 0x23, 0x0a, 0x3e, 0x0a, 0x45, 0x0a, 0x54, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0xee,
+0x02, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x08, 0x03,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xd7, 0x02,
+0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x56, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x1a, 0xbf, 0x02,
+0x11, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a, 0x1c, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x1a, 0xda, 0x01, 0x11, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x08, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0xbf, 0x01, 0x11, 0x03, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x0a, 0x1c, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x02, 0x02,
+0x00, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x1a, 0xa3, 0x01, 0x11, 0x02,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0x8b, 0x01, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x57, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x02, 0x03, 0x01, 0x03, 0x1a,
+0x70, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x5a, 0x11,
+0x02, 0x00, 0x04, 0x01, 0x01, 0x1e, 0x0a, 0x1b, 0x04, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x03, 0x02,
+0x01, 0x01, 0x1a, 0x31, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a,
+0x1b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
+0x02, 0x1a, 0x1a, 0x11, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x0d,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x48, 0x11, 0x02, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x1a, 0x31, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x0a, 0x3e, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x02, 0x01, 0x02, 0x1a, 0x1a, 0x11, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11,
+0x0a, 0x0d, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xe5, 0x06, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00,
+0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x1a, 0xac, 0x06, 0x11, 0x01, 0x00, 0x05, 0x03,
+0x02, 0x23, 0x0a, 0x3e, 0x0a, 0x45, 0x0a, 0x55, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x08, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x06, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x1a, 0xc1, 0x01, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x0a, 0x03, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xaa, 0x01, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x08, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x93, 0x01, 0x11, 0x02, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x0a, 0x1c, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+0x02, 0x02, 0x00, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x1a, 0x78, 0x11,
+0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x0e, 0x02, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x0c, 0x02, 0x01, 0x02, 0x1a, 0x62, 0x11, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x1a, 0x4b, 0x11, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x04, 0x00, 0x10, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x31, 0x11, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x1b, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a, 0x1a, 0x11, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04,
+0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0xb5, 0x04, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11,
+0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0xfc, 0x03, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x02, 0x2f, 0x0a, 0x3e, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x0a, 0x02, 0x01, 0x02, 0x09, 0x00, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00,
+0x0c, 0x04, 0x02, 0x01, 0x01, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x04,
+0x00, 0x08, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x1a, 0xf4, 0x02, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x0c, 0x03, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xdd, 0x02, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0a, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xc6, 0x02, 0x11, 0x02, 0x00, 0x03,
+0x00, 0x01, 0x09, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01,
+0x1a, 0xb3, 0x02, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0b, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x1a, 0x9e, 0x02,
+0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x15, 0x02, 0x00, 0x00, 0x05, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02,
+0x02, 0x02, 0x01, 0x02, 0x1a, 0xff, 0x01, 0x11, 0x02, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x0a, 0x0f, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x1a, 0xe7, 0x01, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x1c, 0x0a, 0x58, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00,
+0x04, 0x00, 0x01, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x1a, 0xbf, 0x01, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x56, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x12, 0x02, 0x01, 0x02, 0x1a, 0xa7, 0x01, 0x11,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x46, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x1a, 0x8b, 0x01, 0x11, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x0a, 0x1b,
+0x0a, 0x19, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00,
+0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x1a, 0x15,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x06, 0x02, 0x04,
+0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x47, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x1b, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x1a, 0x30, 0x11, 0x01,
+0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x07, 0x02, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x1a, 0x11, 0x01, 0x00, 0x05,
+0x01, 0x00, 0x11, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x04, 0x01, 0x07, 0x01,
+0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x4b,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x1c, 0x0b, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x35, 0x11, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x59, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x0a, 0x01, 0x02, 0x02, 0x00, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0x1a, 0x11, 0x02, 0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x0d, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00,
+0x02, 0x01, 0x03, 0x1a, 0xcd, 0x02, 0x11, 0x02, 0x00, 0x04, 0x01, 0x02,
+0x13, 0x0a, 0x1b, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a, 0x92,
+0x02, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x02, 0x02,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xfb, 0x01,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x03, 0x03, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x1a, 0xe4, 0x01, 0x11,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02,
+0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0xc9, 0x01, 0x11, 0x03, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x15,
+0x15, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xb2,
+0x01, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x0a, 0x0d, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x1a, 0x98, 0x01, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d,
+0x0a, 0x2d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x7c, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x01, 0x0d, 0x04, 0x00, 0x18, 0x12, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x1a, 0x66, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x0a, 0x23, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x02, 0x02, 0x00,
+0x04, 0x03, 0x04, 0x03, 0x01, 0x03, 0x1a, 0x4b, 0x11, 0x02, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x0a, 0x1b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0x34, 0x11, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x01, 0x02, 0x01, 0x02, 0x1a, 0x1d, 0x11, 0x01, 0x00, 0x06, 0x00, 0x00,
+0x16, 0x04, 0x00, 0x1c, 0x0a, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x07,
+0x02, 0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x1a,
+0x1a, 0x11, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x23, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0x44, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x0a, 0x1b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
+0x01, 0x02, 0x1a, 0x2d, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a,
+0x1b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x16, 0x11, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x0a, 0x19,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x5f, 0x11, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x12,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x1a, 0x48, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x12, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x03, 0x01, 0x02, 0x1a,
+0x31, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x1a, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x1a, 0x16, 0x11, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x0a,
+0x1d, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x1a, 0x54, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04,
+0x00, 0x0f, 0x0e, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x1a, 0x3e, 0x11, 0x01, 0x00, 0x05, 0x02, 0x00, 0x22, 0x0a, 0x10, 0x08,
+0x11, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x6e, 0x6f, 0x74,
+0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x01, 0x02, 0x01, 0x03, 0x1a, 0xee, 0x0e, 0x11, 0x03, 0x00, 0x04, 0x00,
+0x01, 0x0b, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0c, 0x02, 0x01,
+0x02, 0x1a, 0xd9, 0x0e, 0x11, 0x02, 0x00, 0x03, 0x00, 0x02, 0x10, 0x02,
+0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x04, 0x01, 0x00,
+0x01, 0x01, 0x01, 0x1a, 0xf4, 0x0b, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01,
+0x0f, 0x0a, 0x36, 0x0a, 0x5a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0xd7, 0x0b, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xc0, 0x0b, 0x11, 0x02,
+0x00, 0x03, 0x00, 0x02, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x54, 0x11, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x0a, 0x11, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a, 0x3d, 0x11, 0x01, 0x00, 0x03,
+0x01, 0x01, 0x18, 0x0a, 0x5b, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x04, 0x00, 0x01,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x1a, 0x11, 0x01, 0x00, 0x05, 0x01,
+0x00, 0x11, 0x0a, 0x46, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
+0x02, 0x05, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xc6, 0x0a,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xaf, 0x0a, 0x11,
+0x02, 0x00, 0x03, 0x00, 0x02, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
+0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0xd2, 0x09, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x40, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x1a, 0xba, 0x09, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a, 0x19, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x06, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x1a, 0x92, 0x09, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0xfb, 0x08, 0x11, 0x02, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x45, 0x0a,
+0x30, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03,
+0x03, 0x01, 0x01, 0x03, 0x1a, 0xde, 0x08, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04,
+0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01,
+0x01, 0x1a, 0xa5, 0x08, 0x11, 0x01, 0x00, 0x05, 0x03, 0x02, 0x23, 0x0a,
+0x3e, 0x0a, 0x45, 0x0a, 0x47, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01,
+0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x03,
+0x03, 0x02, 0x01, 0x03, 0x1a, 0x15, 0x11, 0x01, 0x00, 0x04, 0x00, 0x00,
+0x0e, 0x04, 0x00, 0x1a, 0x0e, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x1a, 0xdb, 0x07, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02,
+0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x1a, 0xa2, 0x07, 0x11, 0x01, 0x00, 0x05, 0x03, 0x02, 0x23, 0x0a, 0x3e,
+0x0a, 0x45, 0x0a, 0x5c, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x02, 0x01, 0x02,
+0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03,
+0x02, 0x01, 0x03, 0x1a, 0x2c, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x04, 0x00, 0x0e, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x16, 0x11, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x0a, 0x47,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0xc1, 0x06, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0x21, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x88,
+0x06, 0x11, 0x01, 0x00, 0x05, 0x02, 0x02, 0x20, 0x0a, 0x45, 0x0a, 0x5d,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x06, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x06, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0xbf, 0x02, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0b, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00,
+0x01, 0x0a, 0x02, 0x01, 0x02, 0x1a, 0xaa, 0x02, 0x11, 0x02, 0x00, 0x04,
+0x01, 0x02, 0x13, 0x0a, 0x1b, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x10, 0x02, 0x01, 0x02,
+0x1a, 0xf4, 0x01, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x0f,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x1a, 0xdc, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0xc5, 0x01, 0x11, 0x02, 0x00, 0x03, 0x00, 0x02, 0x1a, 0x04, 0x00, 0x00,
+0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
+0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a,
+0x69, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x19, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a, 0x52,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x16, 0x02, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x3c, 0x11, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a, 0x1b, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05,
+0x02, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a,
+0x15, 0x11, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x07, 0x02,
+0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x37,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02,
+0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x15, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x98, 0x03, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00,
+0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a,
+0x01, 0x01, 0x01, 0x1a, 0xdf, 0x02, 0x11, 0x01, 0x00, 0x03, 0x00, 0x01,
+0x27, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x08, 0x01, 0x01, 0x01, 0x09, 0x00, 0x08, 0x00, 0x0c, 0x00,
+0x04, 0x00, 0x08, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x04, 0x00, 0x08, 0x01,
+0x0c, 0x01, 0x01, 0x01, 0x1a, 0xae, 0x02, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x01, 0x0b, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01,
+0x02, 0x1a, 0x99, 0x02, 0x11, 0x02, 0x00, 0x04, 0x01, 0x02, 0x13, 0x0a,
+0x1b, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x02, 0x12, 0x02, 0x01, 0x02, 0x1a, 0xe3, 0x01, 0x11,
+0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x40, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xcb, 0x01, 0x11,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a, 0x19, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x01, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x1a, 0xa3, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00,
+0x16, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0x8c, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x76,
+0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x1e, 0x0a, 0x1b, 0x04, 0x00, 0x00,
+0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
+0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
+0x02, 0x01, 0x02, 0x1a, 0x4d, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x04, 0x00, 0x06, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x37, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0x21, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x15,
+0x11, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x01, 0x02, 0x04,
+0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x37, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00,
+0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00,
+0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0xc8, 0x02, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0b, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a,
+0x02, 0x01, 0x02, 0x1a, 0xb3, 0x02, 0x11, 0x02, 0x00, 0x04, 0x01, 0x02,
+0x13, 0x0a, 0x1b, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a, 0xfd,
+0x01, 0x11, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x0f, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x1a, 0xe5,
+0x01, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a, 0x58, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x01, 0x01, 0x0c, 0x01,
+0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
+0x01, 0x02, 0x1a, 0xbd, 0x01, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x04, 0x00, 0x05, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0xa6, 0x01, 0x11, 0x01, 0x00, 0x04, 0x02, 0x02, 0x1c, 0x0a,
+0x22, 0x0a, 0x1b, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x06, 0x00, 0x01, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a, 0x66, 0x11, 0x01, 0x00,
+0x05, 0x02, 0x01, 0x0f, 0x0a, 0x33, 0x0a, 0x5e, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0x4a, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x5f, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x1a, 0x33,
+0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x0a, 0x27, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x1a,
+0x1a, 0x11, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x0d, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0x15, 0x11, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e,
+0x04, 0x00, 0x05, 0x02, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x1a, 0x15, 0x11, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x04,
+0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x88, 0x05, 0x11, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a,
+0x3e, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
+0x02, 0x1a, 0xf0, 0x04, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a,
+0x56, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01,
+0x02, 0x1a, 0xd8, 0x04, 0x11, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x1a, 0xbd, 0x04, 0x11, 0x03, 0x00, 0x04, 0x00,
+0x01, 0x0d, 0x04, 0x00, 0x0f, 0x0e, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x02, 0x01, 0x02, 0x1a, 0xa6, 0x04, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02,
+0x0c, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x1a, 0x5f, 0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x1f, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x11, 0x0d, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x01, 0x02, 0x1a, 0x37, 0x11, 0x01, 0x00, 0x04, 0x00,
+0x01, 0x0d, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x1a, 0x21, 0x11, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a,
+0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01,
+0x01, 0x01, 0x1a, 0xaf, 0x03, 0x11, 0x01, 0x00, 0x03, 0x01, 0x01, 0x08,
+0x0a, 0x3c, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0x9b,
+0x03, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x84, 0x03,
+0x11, 0x02, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x13, 0x14, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x1a, 0xed, 0x02, 0x11,
+0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x0a, 0x23, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x05, 0x03, 0x01, 0x03, 0x1a,
+0x3e, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0x28, 0x11,
+0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x0a, 0x3c, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x1a, 0x11, 0x11, 0x01,
+0x00, 0x03, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01,
+0x02, 0x01, 0x01, 0x1a, 0x92, 0x02, 0x11, 0x02, 0x00, 0x03, 0x00, 0x02,
+0x08, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x99, 0x01,
+0x11, 0x01, 0x00, 0x03, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x01, 0x01, 0x1a, 0x59, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x0a, 0x40, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
+0x01, 0x02, 0x1a, 0x42, 0x11, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x0a,
+0x19, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x1a, 0x1b, 0x11, 0x01, 0x00, 0x05, 0x02,
+0x00, 0x10, 0x0a, 0x36, 0x0a, 0x5e, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x1a, 0x2d,
+0x11, 0x01, 0x00, 0x04, 0x02, 0x00, 0x22, 0x0a, 0x1b, 0x0a, 0x26, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04,
+0x01, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x1a, 0x65, 0x11,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x16, 0x0c, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x07, 0x02, 0x01, 0x02, 0x1a, 0x4f, 0x11, 0x01, 0x00,
+0x05, 0x00, 0x01, 0x11, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
+0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x35, 0x11,
+0x03, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x23, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03,
+0x1a, 0x1a, 0x11, 0x02, 0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x60, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03,
+0x01, 0x03, 0x01, 0x03, 0x1a, 0xc8, 0x0b, 0x11, 0x01, 0x00, 0x03, 0x00,
+0x02, 0x08, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x1a, 0xf2,
+0x0a, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0d, 0x0a, 0x0d, 0x0a, 0x61,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x1a, 0xd7, 0x0a, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a,
+0x0d, 0x0a, 0x1e, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xba, 0x0a, 0x11, 0x01, 0x00,
+0x04, 0x00, 0x01, 0x0d, 0x04, 0x00, 0x0e, 0x0d, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xa3, 0x0a, 0x11, 0x01, 0x00, 0x05,
+0x02, 0x01, 0x0d, 0x0a, 0x0d, 0x0a, 0x61, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x1a, 0x88, 0x0a, 0x11,
+0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x1e, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x1a, 0xeb, 0x09, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04,
+0x00, 0x11, 0x15, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x1a, 0xd4, 0x09, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x25,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x12, 0x13, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x1a, 0xb8, 0x09, 0x11, 0x01, 0x00, 0x03, 0x01,
+0x01, 0x08, 0x0a, 0x22, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x1a, 0xa4, 0x09, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x41,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x1a, 0x88, 0x09, 0x11, 0x01, 0x00, 0x05, 0x02,
+0x01, 0x0d, 0x0a, 0x0d, 0x0a, 0x61, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x1a, 0xed, 0x08, 0x11, 0x01,
+0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x1e, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x1a, 0xd0, 0x08, 0x11, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x04, 0x00,
+0x17, 0x0b, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a,
+0xb9, 0x08, 0x11, 0x01, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x1a, 0xd6, 0x07,
+0x11, 0x02, 0x00, 0x04, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x00, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x1a, 0xa0, 0x07, 0x11, 0x02,
+0x00, 0x03, 0x00, 0x01, 0x09, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+0x01, 0x01, 0x1a, 0x8d, 0x07, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0d,
+0x0a, 0x0d, 0x0a, 0x3d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x1a, 0xf2, 0x06, 0x11, 0x01, 0x00, 0x05,
+0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x62, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xd5,
+0x06, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x63,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0xb8, 0x06, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01,
+0x0f, 0x0a, 0x0d, 0x0a, 0x64, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x9b, 0x06, 0x11,
+0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x65, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x1a, 0xfe, 0x05, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a,
+0x0d, 0x0a, 0x66, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xe1, 0x05, 0x11, 0x01, 0x00,
+0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x67, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0xc4, 0x05, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a,
+0x5a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x1a, 0xa7, 0x05, 0x11, 0x01, 0x00, 0x05, 0x02,
+0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x68, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x8a, 0x05,
+0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x69, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x1a, 0xed, 0x04, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f,
+0x0a, 0x0d, 0x0a, 0x5d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xd0, 0x04, 0x11, 0x01,
+0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x5c, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x1a, 0xb3, 0x04, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d,
+0x0a, 0x6a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x96, 0x04, 0x11, 0x01, 0x00, 0x05,
+0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x6b, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xf9,
+0x03, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x6c,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0xdc, 0x03, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01,
+0x0f, 0x0a, 0x0d, 0x0a, 0x6d, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xbf, 0x03, 0x11,
+0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x6e, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x1a, 0xa2, 0x03, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a,
+0x0d, 0x0a, 0x6f, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x85, 0x03, 0x11, 0x01, 0x00,
+0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x70, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a,
+0xe8, 0x02, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a,
+0x71, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x1a, 0xcb, 0x02, 0x11, 0x01, 0x00, 0x05, 0x02,
+0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x72, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xae, 0x02,
+0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x73, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x1a, 0x91, 0x02, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f,
+0x0a, 0x0d, 0x0a, 0x74, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xf4, 0x01, 0x11, 0x01,
+0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x5e, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x1a, 0xd7, 0x01, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d,
+0x0a, 0x75, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0xba, 0x01, 0x11, 0x01, 0x00, 0x05,
+0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x76, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x9d,
+0x01, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x77,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0x80, 0x01, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01,
+0x0f, 0x0a, 0x0d, 0x0a, 0x78, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x1a, 0x64, 0x11, 0x01,
+0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a, 0x79, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x1a, 0x48, 0x11, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x0a, 0x23, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1e, 0x02, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x1a, 0x2d, 0x11, 0x01, 0x00, 0x03, 0x01, 0x01, 0x08,
+0x0a, 0x38, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0x1a,
+0x11, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x0a, 0x35, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x1f, 0x01, 0x04, 0x02, 0x20, 0x02, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x1a, 0x1e, 0x11, 0x02, 0x00, 0x06, 0x01, 0x00, 0x15, 0x0a,
+0x28, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x01, 0x02,
+0x04, 0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x02, 0x01, 0x04, 0x1a, 0x4b,
+0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0d, 0x0a, 0x0d, 0x0a, 0x0e, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x1a, 0x31, 0x11, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x0a, 0x0d, 0x0a,
+0x1e, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x1a, 0x15, 0x11, 0x01, 0x00, 0x04, 0x00, 0x00,
+0x0e, 0x04, 0x00, 0x1b, 0x0d, 0x04, 0x01, 0x0f, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x1a, 0x42, 0x11, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x39,
+0x0a, 0x7a, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x02, 0x0c,
+0x14, 0x04, 0x03, 0x0c, 0x0e, 0x04, 0x04, 0x0c, 0x0d, 0x04, 0x05, 0x0c,
+0x0c, 0x04, 0x06, 0x0c, 0x0b, 0x04, 0x07, 0x0c, 0x0a, 0x04, 0x08, 0x0c,
+0x09, 0x04, 0x09, 0x0c, 0x05, 0x04, 0x0a, 0x0c, 0x03, 0x04, 0x0b, 0x0c,
+0x02, 0x04, 0x0c, 0x0c, 0x04, 0x04, 0x0d, 0x0c, 0x10, 0x01, 0x0d, 0x1a,
+0x31, 0x11, 0x03, 0x00, 0x03, 0x01, 0x01, 0x08, 0x0a, 0x7b, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x1a, 0x1e, 0x11, 0x01, 0x00, 0x06,
+0x01, 0x00, 0x15, 0x0a, 0x28, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x01, 0x02, 0x04, 0x04, 0x01, 0x03,
+0x01, 0x04, 0x1a, 0x7b, 0x11, 0x0d, 0x00, 0x03, 0x0c, 0x00, 0x5c, 0x0a,
+0x00, 0x0a, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04, 0x0a, 0x05, 0x0a,
+0x06, 0x0a, 0x07, 0x0a, 0x08, 0x0a, 0x09, 0x0a, 0x0a, 0x0a, 0x0b, 0x04,
+0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x07, 0x00,
+0x01, 0x04, 0x00, 0x00, 0x04, 0x07, 0x00, 0x02, 0x04, 0x00, 0x00, 0x05,
+0x07, 0x00, 0x03, 0x04, 0x00, 0x00, 0x06, 0x07, 0x00, 0x04, 0x04, 0x00,
+0x00, 0x07, 0x07, 0x00, 0x05, 0x04, 0x00, 0x00, 0x08, 0x07, 0x00, 0x06,
+0x04, 0x00, 0x00, 0x09, 0x07, 0x00, 0x07, 0x04, 0x00, 0x00, 0x0a, 0x07,
+0x00, 0x08, 0x04, 0x00, 0x00, 0x0b, 0x07, 0x00, 0x09, 0x04, 0x00, 0x00,
+0x0c, 0x07, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x0d, 0x07, 0x00, 0x0b, 0x04,
+0x00, 0x00, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x00, 
+};
+
+void
+pic_init_lib(pic_state *PIC_UNUSED(pic))
+{
+  pic_call(pic, pic_deserialize_static(pic, lib_rom, sizeof lib_rom, pic_false_value(pic)), 0);
+}
@@ -4,6 +4,7 @@
 
 #include "picrin.h"
 #include "picrin/extra.h"
+#include "picrin/lib.h"
 
 void
 pic_init_picrin(pic_state *pic)
@@ -15,12 +16,75 @@ pic_init_picrin(pic_state *pic)
   pic_init_lib(pic);
   pic_init_contrib(pic);
   pic_load_piclib(pic);
+
+  /* C libraries leave themselves as the current library */
+  pic_in_library(pic, "picrin.user");
 }
 
 int picrin_argc;
 char **picrin_argv;
 char **picrin_envp;
 
+/*
+ * picrin --save-image FILE writes the heap, with (picrin main) and the
+ * libraries it uses instantiated and (picrin user) set up, to FILE. picrin --image FILE [args]
+ * starts from that heap instead of instantiating them again.
+ */
+
+static const char *image_path, *save_path;
+
+/* the image is read inside pic_try, but put in place and saved outside,
+   as its exception handler is bound in the dynamic environment that an
+   image replaces */
+
+static int
+load_image(pic_state *pic, const char *path)
+{
+  FILE *fp;
+  pic_value image, roots, e;
+  long len;
+
+  if ((fp = fopen(path, "rb")) == NULL) {
+    fprintf(stderr, "could not open image: %s\n", path);
+    return 1;
+  }
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  image = pic_blob_value(pic, NULL, len);
+  if (fread(pic_blob(pic, image, NULL), 1, len, fp) != (size_t) len) {
+    fclose(fp);
+    fprintf(stderr, "could not read image: %s\n", path);
+    return 1;
+  }
+  fclose(fp);
+  pic_try {
+    roots = pic_read_image(pic, image);
+  }
+  pic_catch(e) {
+    fprintf(stderr, "could not load image: %s\n", path);
+    pic_funcall(pic, "display", 2, e, pic_stderr(pic));
+    return 1;
+  }
+  pic_load_image(pic, roots);
+  return 0;
+}
+
+static int
+save_image(pic_state *pic, const char *path)
+{
+  FILE *fp;
+  const unsigned char *buf;
+  int len;
+
+  buf = pic_blob(pic, pic_save_image(pic), &len);
+  if ((fp = fopen(path, "wb")) == NULL || fwrite(buf, 1, len, fp) != (size_t) len || fclose(fp) != 0) {
+    fprintf(stderr, "could not write image: %s\n", path);
+    return 1;
+  }
+  return 0;
+}
+
 int
 main(int argc, char *argv[], char **envp)
 {
@@ -30,22 +94,55 @@ main(int argc, char *argv[], char **envp)
 
   pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
 
+  if (argc >= 3 && strcmp(argv[1], "--image") == 0) {
+    image_path = argv[2];
+    argv[2] = argv[0];
+    argc -= 2;
+    argv += 2;
+  } else if (argc == 3 && strcmp(argv[1], "--save-image") == 0) {
+    save_path = argv[2];
+  }
+
   picrin_argc = argc;
   picrin_argv = argv;
   picrin_envp = envp;
 
+  status = 0;
+
   pic_try {
     pic_init_picrin(pic);
-
-    pic_funcall(pic, "picrin.main:main", 0);
-
-    status = 0;
   }
   pic_catch(e) {
     pic_funcall(pic, "display", 2, e, pic_stderr(pic));
     status = 1;
   }
 
+  if (status == 0 && image_path) {
+    status = load_image(pic, image_path);
+  }
+
+  if (status == 0) {
+    pic_try {
+      /* bundled libraries are instantiated on first use */
+      pic_funcall(pic, "library-exports", 1, pic_intern_lit(pic, "picrin.main"));
+
+      if (! save_path) {
+        pic_funcall(pic, "picrin.main:main", 0);
+      } else {
+        /* what -e and the REPL evaluate in */
+        pic_funcall(pic, "picrin.repl:init-env", 0);
+      }
+    }
+    pic_catch(e) {
+      pic_funcall(pic, "display", 2, e, pic_stderr(pic));
+      status = 1;
+    }
+  }
+
+  if (status == 0 && save_path) {
+    status = save_image(pic, save_path);
+  }
+
   pic_close(pic);
 
   return status;
@@ -0,0 +1,336 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+/*
+ * Generates src/load_piclib.c. Each library file given on the command line
+ * is evaluated in order and its image (see make-library-image) is written
+ * out as a byte array, so that pic_load_piclib loads the libraries without
+ * reading, expanding or compiling them. A file whose image cannot be made
+ * is embedded as source and evaluated at startup as before.
+ */
+
+#include <ctype.h>
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/lib.h"
+
+void pic_init_lib(pic_state *);
+void pic_init_contrib(pic_state *);
+
+int picrin_argc;
+char **picrin_argv;
+char **picrin_envp;
+
+static bool evaluated;
+
+static pic_value
+eval_file(pic_state *pic)
+{
+  pic_value port = pic_closure_ref(pic, 0), form;
+  size_t ai;
+
+  pic_get_args(pic, "");
+
+  ai = pic_enter(pic);
+  while (1) {
+    form = pic_funcall(pic, "read", 1, port);
+    if (pic_eof_p(pic, form))
+      break;
+    pic_funcall(pic, "eval", 1, form);
+    pic_leave(pic, ai);
+  }
+  evaluated = true;
+  return pic_undef_value(pic);
+}
+
+static void
+print_var(const char *prefix, const char *file)
+{
+  const char *p = strrchr(file, '.');
+  const char *end = p ? p : file + strlen(file);
+
+  printf("%s", prefix);
+  for (p = file; p != end; ++p) {
+    putchar(isalnum((unsigned char) *p) ? *p : '_');
+  }
+}
+
+static void
+print_image(const char *file, const unsigned char *bin, int len)
+{
+  int i;
+
+  print_var("static const unsigned char piclib_image_", file);
+  printf("[] = {\n");
+  for (i = 0; i < len; ++i) {
+    printf("0x%02x,", bin[i]);
+    if ((i + 1) % 12 == 0) {
+      putchar('\n');
+    } else {
+      putchar(' ');
+    }
+  }
+  if (len != 0) {
+    puts("");
+  }
+  printf("};\n\n");
+}
+
+static void
+print_source(const char *file)
+{
+  FILE *in = fopen(file, "r");
+  int c, col = 0;
+
+  print_var("static const char piclib_src_", file);
+  printf("[][80] = {\n\"");
+  while ((c = getc(in)) != EOF) {
+    if (col++ == 80) {
+      printf("\",\n\"");
+      col = 1;
+    }
+    switch (c) {
+    case '\n': printf("\\n"); break;
+    case '"': printf("\\\""); break;
+    case '\\': printf("\\\\"); break;
+    default: putchar(c);
+    }
+  }
+  printf("\",\n\"\"\n};\n\n");
+  fclose(in);
+}
+
+static const char *
+short_name(const char *file)
+{
+  const char *name = file, *p;
+
+  /* dir/file.scm */
+  for (p = file; *p; ++p) {
+    if (*p == '/' && strchr(p + 1, '/')) {
+      name = p + 1;
+    }
+  }
+  return name;
+}
+
+static void
+print_load(const char *file)
+{
+  printf("  pic_try {\n");
+  print_var("    pic_eval_native(pic, &piclib_src_", file);
+  printf("[0][0]);\n");
+  printf("  }\n");
+  printf("  pic_catch(e) {\n");
+  printf("    /* error! */\n");
+  printf("    pic_fputs(pic, \"fatal error: failure in loading %s\\n\", pic_stderr(pic));\n", short_name(file));
+  printf("    pic_raise(pic, e);\n");
+  printf("  }\n");
+}
+
+struct image {
+  int index;                    /* in piclib_images, or -1 */
+  char *libs;                   /* symbols of the libraries it provides */
+  int nlibs;
+};
+
+static int nimages;
+static long count;
+
+static void
+make_image(pic_state *pic, const char *path, struct image *image)
+{
+  size_t ai = pic_enter(pic);
+  FILE *file = fopen(path, "r");
+  const unsigned char *bin;
+  pic_value port, thunk, e, r, name, it;
+  int len;
+
+  if (! file) {
+    fprintf(stderr, "could not open file %s\n", path);
+    exit(1);
+  }
+  port = pic_fopen(pic, file, "r");
+  thunk = pic_lambda(pic, eval_file, 1, port);
+
+  image->index = -1;
+
+  evaluated = false;
+  pic_try {
+    /* (image count names) */
+    r = pic_funcall(pic, "make-library-image", 1, thunk);
+    bin = pic_blob(pic, pic_car(pic, r), &len);
+    print_image(path, bin, len);
+    image->index = nimages++;
+    if (pic_int_p(pic, pic_list_ref(pic, r, 1))) {
+      count = pic_int(pic, pic_list_ref(pic, r, 1));
+    }
+    image->nlibs = pic_length(pic, pic_list_ref(pic, r, 2));
+    image->libs = calloc(1, 1);
+    pic_for_each (name, pic_list_ref(pic, r, 2), it) {
+      const char *str = pic_str(pic, pic_sym_name(pic, name), NULL);
+      size_t n = strlen(image->libs);
+
+      image->libs = realloc(image->libs, n + strlen(str) + 32);
+      sprintf(image->libs + n, ", pic_intern_lit(pic, \"%s\")", str);
+    }
+  }
+  pic_catch(e) {
+    if (! evaluated) {
+      pic_funcall(pic, "display", 2, e, pic_stderr(pic));
+      exit(1);
+    }
+    /* the file has been loaded all the same; keep its source */
+    pic_fprintf(pic, pic_stderr(pic), "picrin-mkimage: %s is loaded from source: ", path);
+    pic_funcall(pic, "display", 2, e, pic_stderr(pic));
+    pic_fprintf(pic, pic_stderr(pic), "\n");
+  }
+  pic_fclose(pic, port);
+  pic_leave(pic, ai);
+}
+
+int
+main(int argc, char *argv[], char **envp)
+{
+  pic_state *pic;
+  pic_value e;
+  struct image *images;
+  int i;
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+
+  picrin_argc = argc;
+  picrin_argv = argv;
+  picrin_envp = envp;
+
+  images = calloc(argc, sizeof(struct image));
+
+  printf("/**\n"
+         " *                                !!NOTICE!!\n"
+         " * This file was automatically generated by picrin-mkimage, and includes\n"
+         " * all of the prelude libraries required by Picrin. PLEASE DO NOT EDIT THIS\n"
+         " * FILE, changes will be overwritten the next time the program runs.\n"
+         " */\n"
+         "\n"
+         "#include \"picrin.h\"\n"
+         "#include \"picrin/extra.h\"\n"
+         "\n"
+         "void\n"
+         "pic_eval_native(pic_state *pic, const char *str)\n"
+         "{\n"
+         "  size_t ai = pic_enter(pic);\n"
+         "  pic_value port = pic_fmemopen(pic, str, strlen(str), \"r\"), e;\n"
+         "\n"
+         "  pic_try {\n"
+         "    size_t ai = pic_enter(pic);\n"
+         "\n"
+         "    while (1) {\n"
+         "      pic_value form = pic_funcall(pic, \"read\", 1, port);\n"
+         "      if (pic_eof_p(pic, form))\n"
+         "        break;\n"
+         "      pic_funcall(pic, \"eval\", 1, form);\n"
+         "      pic_leave(pic, ai);\n"
+         "    }\n"
+         "  }\n"
+         "  pic_catch (e) {\n"
+         "    pic_fclose(pic, port);\n"
+         "    pic_raise(pic, e);\n"
+         "  }\n"
+         "  pic_fclose(pic, port);\n"
+         "  pic_leave(pic, ai);\n"
+         "}\n"
+         "\n");
+
+  pic_try {
+    pic_init_lib(pic);
+    pic_init_contrib(pic);
+    pic_in_library(pic, "picrin.user");
+  }
+  pic_catch(e) {
+    pic_funcall(pic, "display", 2, e, pic_stderr(pic));
+    exit(1);
+  }
+
+  for (i = 1; i < argc; ++i) {
+    make_image(pic, argv[i], &images[i]);
+  }
+
+  for (i = 1; i < argc; ++i) {
+    if (images[i].index < 0) {
+      print_source(argv[i]);
+    }
+  }
+
+  printf("static const struct {\n"
+         "  const char *file;\n"
+         "  const unsigned char *image;\n"
+         "  int len;\n"
+         "} piclib_images[] = {\n");
+  for (i = 1; i < argc; ++i) {
+    if (images[i].index >= 0) {
+      printf("  { \"%s\", ", short_name(argv[i]));
+      print_var("piclib_image_", argv[i]);
+      print_var(", sizeof piclib_image_", argv[i]);
+      printf(" },\n");
+    }
+  }
+  printf("  { NULL, NULL, 0 }\n"
+         "};\n"
+         "\n"
+         "static pic_value\n"
+         "load_image(pic_state *pic)\n"
+         "{\n"
+         "  int i = pic_int(pic, pic_closure_ref(pic, 0));\n"
+         "  pic_value image, e;\n"
+         "\n"
+         "  pic_get_args(pic, \"\");\n"
+         "\n"
+         "  pic_try {\n"
+         "    /* the code stays in piclib_images, shared by every state */\n"
+         "    image = pic_deserialize_static(pic, piclib_images[i].image, piclib_images[i].len, pic_ref(pic, \"library-image-reference\"));\n"
+         "    pic_funcall(pic, \"load-library-image\", 1, image);\n"
+         "  }\n"
+         "  pic_catch(e) {\n"
+         "    pic_fprintf(pic, pic_stderr(pic), \"fatal error: failure in loading %%s\\n\", piclib_images[i].file);\n"
+         "    pic_raise(pic, e);\n"
+         "  }\n"
+         "  return pic_undef_value(pic);\n"
+         "}\n"
+         "\n");
+
+  printf("void\n"
+         "pic_load_piclib(pic_state *pic)\n"
+         "{\n"
+         "  size_t ai = pic_enter(pic);\n");
+  for (i = 1; i < argc; ++i) {
+    if (images[i].index < 0) {
+      printf("  pic_value e;\n");   /* for print_load */
+      break;
+    }
+  }
+  printf("\n"
+         "  pic_register_func(pic, \"piclib-image\", load_image);\n"
+         "\n"
+         "  /* identifiers numbered at runtime must not clash with those in images */\n"
+         "  pic_funcall(pic, \"replay-journal\", 1, pic_list(pic, 2, pic_intern_lit(pic, \"uniq\"), pic_int_value(pic, %ld)));\n"
+         "\n", count);
+  for (i = 1; i < argc; ++i) {
+    if (images[i].index < 0) {
+      print_load(argv[i]);
+    } else if (images[i].nlibs == 0) {
+      printf("  pic_call(pic, pic_lambda(pic, load_image, 1, pic_int_value(pic, %d)), 0);\n", images[i].index);
+    } else {
+      printf("  pic_funcall(pic, \"add-library-loader!\", 2, pic_list(pic, %d%s), pic_lambda(pic, load_image, 1, pic_int_value(pic, %d)));\n", images[i].nlibs, images[i].libs, images[i].index);
+    }
+    printf("  pic_leave(pic, ai);\n");
+  }
+  printf("}\n");
+
+  for (i = 1; i < argc; ++i) {
+    free(images[i].libs);
+  }
+  free(images);
+  pic_close(pic);
+  return 0;
+}
@@ -0,0 +1,121 @@
+(import (scheme base)
+        (picrin test))
+
+(test-begin)
+
+;; a generator that keeps its place in the list by re-entering walk
+
+(define (make-generator lst)
+  (define return #f)
+  (define (walk l)
+    (when (pair? l)
+      (call/cc
+       (lambda (k)
+         (set! resume k)
+         (return (car l))))
+      (walk (cdr l))))
+  (define (resume _)
+    (walk lst)
+    (return 'done))
+  (lambda ()
+    (call/cc
+     (lambda (r)
+       (set! return r)
+       (resume #f)))))
+
+(define g (make-generator '(1 2 3)))
+(define (take n)
+  (if (= n 0) '() (let ((x (g))) (cons x (take (- n 1))))))
+
+(test '(1 2 3 done) (take 4))
+
+;; re-entering a continuation whose call/cc has returned
+
+(define (count-to n)
+  (let* ((seen '())
+         (k #f)
+         (i (call/cc (lambda (c) (set! k c) 0))))
+    (set! seen (cons i seen))
+    (if (< i n)
+        (k (+ i 1))
+        (reverse seen))))
+
+(test '(0 1 2 3) (count-to 3))
+
+;; amb
+
+(define fail #f)
+
+(define (amb choices)
+  (let ((prev fail))
+    (call/cc
+     (lambda (k)
+       (for-each*
+        (lambda (x)
+          (call/cc
+           (lambda (next)
+             (set! fail (lambda () (next #f)))
+             (k x))))
+        choices)
+       (set! fail prev)
+       (prev)))))
+
+(define (for-each* f l)
+  (when (pair? l)
+    (f (car l))
+    (for-each* f (cdr l))))
+
+(test '(3 4 5)
+      (call/cc
+       (lambda (k)
+         (set! fail (lambda () (k 'none)))
+         (let* ((a (amb '(1 2 3 4 5)))
+                (b (amb '(1 2 3 4 5)))
+                (c (amb '(1 2 3 4 5))))
+           (if (and (< a b) (= (+ (* a a) (* b b)) (* c c)))
+               (list a b c)
+               (fail))))))
+
+;; map calls its procedure from the VM, so it can be escaped from and
+;; re-entered, and earlier returns keep their results
+
+(test 3 (call/cc (lambda (k) (for-each (lambda (x) (if (= x 3) (k x))) '(1 2 3 4)))))
+
+(test '((1 20 3) (1 10 3) (1 2 3))
+      (let ((k #f) (n 0) (rs '()))
+        (let ((r (map (lambda (x) (call/cc (lambda (c) (if (= x 2) (set! k c)) x))) '(1 2 3))))
+          (set! rs (cons r rs))
+          (if (< n 2)
+              (begin (set! n (+ n 1)) (k (* 10 n)))
+              rs))))
+
+(test '(#(1 20) #(1 2))
+      (let ((k #f) (rs '()))
+        (let ((r (vector-map (lambda (x) (call/cc (lambda (c) (if (= x 2) (set! k c)) x))) #(1 2))))
+          (set! rs (cons r rs))
+          (if (= (length rs) 1)
+              (k 20)
+              rs))))
+
+;; the frames a continuation returns to are marked without recursing on
+;; the C stack, however many there are
+
+(define (deep n)
+  (if (= n 0) 0 (+ 1 (deep (- n 1)))))
+
+(test 100000 (deep 100000))
+
+;; a continuation captured under a C call cannot return into it again
+
+(define k #f)
+(define out #f)
+
+(with-exception-handler
+ (lambda (e) (out (error-object-message e)))
+ (lambda ()
+   (assoc 1 '((1 . a)) (lambda (x y) (call/cc (lambda (c) (set! k c) #t))))))
+
+(test "re-entered continuation returned to a C call that has exited"
+      (call/cc (lambda (c) (set! out c) (k #f))))
+
+(test-end)
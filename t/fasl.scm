@@ -0,0 +1,107 @@
+(import (scheme base)
+        (scheme inexact)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define (round-trip obj)
+  (bytevector->object (object->bytevector obj)))
+
+(define data
+  '(0 -1 2147483647 -2147483648 1.5 -0.0 #\a "str" sym #t #f ()
+    (1 2 . 3) #(1 "a" b) #u8(0 1 255)))
+
+(test data (round-trip data))
+(test #t (infinite? (round-trip (/ 1. 0))))
+(test #t (nan? (round-trip (/ 0. 0))))
+
+; shared and cyclic structure
+(define shared (list 1 2))
+(define v (round-trip (list shared shared)))
+(test #t (eq? (car v) (cadr v)))
+
+(define cycle (list 1 2 3))
+(set-cdr! (cddr cycle) cycle)
+(define c (round-trip cycle))
+(test '(1 2 3) (list (car c) (cadr c) (car (cddr c))))
+(test #t (eq? c (cdr (cddr c))))
+
+(define vec (make-vector 2 0))
+(vector-set! vec 1 vec)
+(define w (round-trip vec))
+(test #t (eq? w (vector-ref w 1)))
+
+(test 100000 (length (round-trip (make-list 100000 'x))))
+
+; dictionaries, hash tables and records
+(define d (round-trip (dictionary 'a 1 'b "two")))
+(test 1 (dictionary-ref d 'a))
+(test "two" (dictionary-ref d 'b))
+
+(define h (make-hash-table equal?))
+(hash-table-set! h '(1 2) 'x)
+(hash-table-set! h "k" 3)
+(define h2 (round-trip h))
+(test 'x (hash-table-ref h2 '(1 2)))
+(test 3 (hash-table-ref h2 "k"))
+
+(define-record-type point (make-point x y) point? (x point-x) (y point-y))
+(define p (round-trip (make-point 1 2)))
+(test #t (point? p))
+(test 1 (point-x p))
+(test 2 (point-y p))
+
+; a type with the same name and fields is still another type
+(define-record-type point (make-other x y) other? (x other-x) (y other-y))
+(define o (round-trip (make-other 3 4)))
+(test #t (other? o))
+(test #f (point? o))
+(test 3 (other-x o))
+
+; closures keep their environment, shared between them
+(define (make-counter)
+  (let ((n 0))
+    (cons (lambda () (set! n (+ n 1)) n)
+          (lambda () n))))
+(define counter (round-trip (make-counter)))
+((car counter))
+((car counter))
+(test 2 ((cdr counter)))
+
+; objects named by a key are stored as the key
+(define externs
+  (bytevector->object
+   (object->bytevector (list car 'x)
+                       (lambda (obj) (and (eq? obj car) 'car)))
+   (lambda (key) (and (eq? key 'car) car))))
+(test #t (eq? car (car externs)))
+
+; procedures written in C are stored by name
+(test 1 ((round-trip car) '(1 2)))
+(define param (make-parameter 10))
+(test 10 ((round-trip param)))
+
+; attributes
+(define attr (make-attribute))
+(attr 'key 42)
+(test 42 ((round-trip attr) 'key))
+
+; malformed input
+(test #t (call/cc
+          (lambda (k)
+            (with-exception-handler
+             (lambda (e) (k #t))
+             (lambda () (bytevector->object (bytevector 1 2 3)) #f)))))
+(test #t (call/cc
+          (lambda (k)
+            (with-exception-handler
+             (lambda (e) (k #t))
+             (lambda () (bytevector->object (bytevector-copy (object->bytevector '(1 2 3)) 0 8)) #f)))))
+(test #t (call/cc
+          (lambda (k)
+            (with-exception-handler
+             (lambda (e) (k #t))
+             (lambda () (object->bytevector (open-input-string "x")) #f)))))
+
+(test-end)
@@ -0,0 +1,180 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+/*
+ * Runs scripts on a budget with pic_run: a loop that never ends, tasks
+ * whose parameters and escape continuations span several slices, one
+ * that fails halfway, and a thousand of them sharing one thread.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/lib.h"
+
+#define NTASKS 1000
+#define FUEL 1000
+
+void pic_init_lib(pic_state *);
+void pic_init_contrib(pic_state *);
+void pic_load_piclib(pic_state *);
+
+int picrin_argc;
+char **picrin_argv;
+char **picrin_envp;
+
+static const char prelude[] =
+  "(import (scheme base))"
+  "(define p (make-parameter 1))"
+  "(define (forever) (let loop () (loop)))"
+  "(define (fib n) (if (< n 2) n (+ (fib (- n 1)) (fib (- n 2)))))"
+  "(define (escape)"
+  "  (parameterize ((p 2))"
+  "    (call/cc"
+  "      (lambda (k)"
+  "        (let loop ((i 0))"
+  "          (if (= i 100000) (k (* i (p))) (loop (+ i 1))))))))"
+  "(define (fail) (let loop ((i 0)) (if (= i 50000) (error \"boom\") (loop (+ i 1)))))"
+  "(define (count) (let loop ((i 0)) (if (= i 10000) i (loop (+ i 1)))))";
+
+static pic_value
+eval_all(pic_state *pic, const char *str)
+{
+  pic_value port = pic_fmemopen(pic, str, strlen(str), "r"), form, r = pic_undef_value(pic);
+  pic_value env = pic_funcall(pic, "library-environment", 1, pic_intern_lit(pic, "picrin.user"));
+
+  while (1) {
+    form = pic_funcall(pic, "read", 1, port);
+    if (pic_eof_p(pic, form))
+      break;
+    r = pic_funcall(pic, "eval", 2, form, env);
+  }
+  pic_fclose(pic, port);
+  return r;
+}
+
+/* runs task to the end, checking the host's view in between; returns the number of slices */
+static int
+finish(pic_state *pic, pic_value task, pic_value *result)
+{
+  pic_value p = eval_all(pic, "p");
+  int n = 1;
+
+  while (! pic_run(pic, task, FUEL, &task)) {
+    if (pic_int(pic, pic_call(pic, p, 0)) != 1) {
+      fprintf(stderr, "a parameterization leaked out of a task\n");
+      return -1;
+    }
+    n++;
+  }
+  *result = task;
+  return n;
+}
+
+static int
+test(pic_state *pic)
+{
+  pic_value task, r, e, tasks[NTASKS];
+  clock_t t, longest = 0;
+  int i, n, done, failed;
+
+  task = eval_all(pic, "forever");
+  for (i = 0; i < 100; ++i) {
+    if (pic_run(pic, task, FUEL, &task)) {
+      fprintf(stderr, "forever finished\n");
+      return 0;
+    }
+  }
+
+  if ((n = finish(pic, eval_all(pic, "(lambda () (fib 20))"), &r)) < 0 || pic_int(pic, r) != 6765) {
+    return 0;
+  }
+  printf("fib: %d slices\n", n);
+
+  if ((n = finish(pic, eval_all(pic, "escape"), &r)) < 0 || pic_int(pic, r) != 200000) {
+    return 0;
+  }
+  printf("escape: %d slices\n", n);
+
+  if (pic_run(pic, eval_all(pic, "fail"), FUEL, &task)) {
+    return 0;
+  }
+  failed = 0;
+  pic_try {
+    finish(pic, task, &r);
+  }
+  pic_catch(e) {
+    (void) e;
+    failed = 1;
+  }
+  if (! failed) {
+    fprintf(stderr, "fail did not fail\n");
+    return 0;
+  }
+  pic_try {
+    pic_run(pic, task, FUEL, &r);
+    failed = 0;
+  }
+  pic_catch(e) {
+    (void) e;
+  }
+  if (! failed) {
+    fprintf(stderr, "a failed task was resumed\n");
+    return 0;
+  }
+
+  for (i = 0; i < NTASKS; ++i) {
+    tasks[i] = eval_all(pic, "count");
+  }
+  n = 0;
+  do {
+    done = 0;
+    for (i = 0; i < NTASKS; ++i) {
+      if (pic_false_p(pic, tasks[i])) {
+        done++;
+        continue;
+      }
+      t = clock();
+      if (pic_run(pic, tasks[i], FUEL, &tasks[i])) {
+        if (pic_int(pic, tasks[i]) != 10000) {
+          return 0;
+        }
+        tasks[i] = pic_false_value(pic);
+      }
+      t = clock() - t;
+      longest = t > longest ? t : longest;
+      n++;
+    }
+  } while (done < NTASKS);
+  printf("%d tasks: %d slices of %d calls, the longest %.0f us\n", NTASKS, n, FUEL, (double) longest * 1000000 / CLOCKS_PER_SEC);
+  return 1;
+}
+
+int
+main(void)
+{
+  pic_state *pic;
+  pic_value e;
+  int ok = 0;
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+
+  pic_try {
+    pic_init_lib(pic);
+    pic_init_contrib(pic);
+    pic_load_piclib(pic);
+    pic_in_library(pic, "picrin.user");
+    eval_all(pic, prelude);
+    ok = test(pic);
+  }
+  pic_catch(e) {
+    pic_fputs(pic, "error: ", pic_stderr(pic));
+    pic_funcall(pic, "write", 2, e, pic_stderr(pic));
+    pic_fputs(pic, "\n", pic_stderr(pic));
+  }
+
+  pic_close(pic);
+  return ! ok;
+}
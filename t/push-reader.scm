@@ -0,0 +1,96 @@
+(import (scheme base)
+        (scheme write)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define text
+  "(a \"b)\\\"c\" |d e| #\\( #\\)) 42 ; (
+#| #| ( |# |# 'q `(1 ,x ,@y) #;(skip) kept #(1 2) #u8(1 2) #t #x1F sym\n")
+
+(define expected
+  '((a "b)\"c" |d e| #\( #\)) 42 'q `(1 ,x ,@y) kept #(1 2) #u8(1 2) #t 31 sym))
+
+(define (feed-in-chunks reader str n)
+  (let loop ((i 0) (acc '()))
+    (if (>= i (string-length str))
+        acc
+        (let ((j (min (+ i n) (string-length str))))
+          (loop j (append acc (push-reader-feed! reader (string-copy str i j))))))))
+
+(test #t (push-reader? (make-push-reader)))
+(test #f (push-reader? 1))
+
+(test expected (push-reader-feed! (make-push-reader) text))
+(test expected (feed-in-chunks (make-push-reader) text 1))
+(test expected (feed-in-chunks (make-push-reader) text 5))
+
+(define r (make-push-reader))
+
+(test '() (push-reader-feed! r "(1 2"))
+(test '((1 2 3)) (push-reader-feed! r (bytevector 32 51 41 32)))
+(test '() (push-reader-feed! r "abc"))
+(test '(abc) (push-reader-feed! r " "))
+
+;; #; inside a list skips an element, not a top-level datum
+
+(define r (make-push-reader))
+
+(test '((a c)) (push-reader-feed! r "(a #;b c) "))
+(test '((d)) (push-reader-feed! r "(d) "))
+(test '(f) (push-reader-feed! r "#;(e) f "))
+
+;; a bad datum does not take the ones before it along
+
+(define (feed-error reader str)
+  (call/cc
+   (lambda (k)
+     (with-exception-handler
+      (lambda (e) (k 'error))
+      (lambda () (push-reader-feed! reader str))))))
+
+(define r (make-push-reader))
+
+(test '(1 2) (push-reader-feed! r "1 2 #<bad> 3 "))
+(test 'error (feed-error r ""))
+(test '(3) (push-reader-feed! r ""))
+
+;; #!fold-case holds across datums and feeds
+
+(define r (make-push-reader))
+
+(test '(abc def) (push-reader-feed! r "#!fold-case ABC DEF "))
+(test '(ghi) (push-reader-feed! r "GHI "))
+(test '(JKL) (push-reader-feed! r "#!no-fold-case JKL "))
+
+;; one feed that reads enough to trigger the GC
+
+(define long-list
+  (let loop ((i 99) (l '()))
+    (if (< i 0)
+        l
+        (loop (- i 1) (cons i l)))))
+
+(define many
+  (let ((unit (string->utf8 (string-append (call-with-port (open-output-string)
+                                             (lambda (port)
+                                               (write long-list port)
+                                               (get-output-string port)))
+                                           " ")))
+        (out (open-output-bytevector)))
+    (let loop ((i 0))
+      (when (< i 5000)
+        (write-bytevector unit out)
+        (loop (+ i 1))))
+    (get-output-bytevector out)))
+
+(define l (push-reader-feed! (make-push-reader) many))
+
+(test 5000 (length l))
+(test #t (let loop ((l l))
+          (or (null? l)
+              (and (equal? (car l) long-list)
+                   (loop (cdr l))))))
+
+(test-end)
@@ -0,0 +1,71 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define-record-type <point>
+    (make-point x y)
+    point?
+  (x point-x set-point-x!)
+  (y point-y)
+  (tag point-tag set-point-tag!))
+
+(define-record-type <other>
+    (make-other a)
+    other?
+  (a other-a))
+
+(define p (make-point 1 2))
+
+(test #t (point? p))
+(test #f (point? (make-other 1)))
+(test #f (point? 'point))
+(test 1 (point-x p))
+(test 2 (point-y p))
+(set-point-x! p 10)
+(test 10 (point-x p))
+(set-point-tag! p 'a)
+(test 'a (point-tag p))
+(test '(10 3) (map point-x (list p (make-point 3 4))))
+(test #t (equal? (make-point 1 2) (make-point 1 2)))
+(test #f (equal? (make-point 1 2) (make-point 1 3)))
+
+(test #t (record-type? <point>))
+(test '<point> (record-type-name <point>))
+(test '(x y tag) (record-type-fields <point>))
+(test <point> (record-type p))
+(test 2 (record-ref p <point> 1))
+
+(test "record type mismatch"
+      (call/cc
+       (lambda (k)
+         (with-exception-handler
+          (lambda (e) (k (error-object-message e)))
+          (lambda () (point-x (make-other 1)))))))
+
+(define old-tag point-tag)
+(define old-point? point?)
+
+(define-record-type <point>
+    (make-point x)
+    point?
+  (x point-x))
+
+(test #t (old-point? p))
+(test #f (old-point? (make-point 1)))
+(test 'a (old-tag p))
+(test "record type mismatch"
+      (call/cc
+       (lambda (k)
+         (with-exception-handler
+          (lambda (e) (k (error-object-message e)))
+          (lambda () (old-tag (make-point 1)))))))
+(test "index out of range"
+      (call/cc
+       (lambda (k)
+         (with-exception-handler
+          (lambda (e) (k (error-object-message e)))
+          (lambda () (record-ref (make-point 1) <point> 2))))))
+
+(test-end)
@@ -0,0 +1,194 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+/*
+ * Serves the same request again and again from one state, resetting it
+ * to a checkpoint in between, and checks that no request sees what the
+ * previous one did. Then compares how many requests a second that gets
+ * through against opening a fresh state for each of them.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/lib.h"
+
+#define NREQUESTS 2000
+#define NFRESH 10
+
+void pic_init_lib(pic_state *);
+void pic_init_contrib(pic_state *);
+void pic_load_piclib(pic_state *);
+
+int picrin_argc;
+char **picrin_argv;
+char **picrin_envp;
+
+static const char prelude[] =
+  "(import (scheme base) (scheme read) (scheme write) (srfi 69))"
+  "(define hits 0)"
+  "(define cell (list 'a 'b))"
+  "(define vec (make-vector 3 0))"
+  "(define bv (bytevector 1 2 3))"
+  "(define word (make-string 3 #\\a))"
+  "(define tbl (make-hash-table))"
+  "(hash-table-set! tbl 'k 1)"
+  "(define p (make-parameter 10))"
+  "(define-record-type <point> (make-point x y) point? (x point-x set-point-x!))"
+  "(define pt (make-point 1 2))"
+  "(define counter (let ((n 0)) (lambda () (set! n (+ n 1)) n)))"
+  "(define (handle str)"
+  "  (let ((seen (list hits (car cell) (vector-ref vec 0) (bytevector-u8-ref bv 0) (string-copy word)"
+  "                    (hash-table-ref/default tbl 'k #f) (hash-table-ref/default tbl 'new #f)"
+  "                    (point-x pt) (counter) (p))))"
+  "    (set! hits (+ hits 1))"
+  "    (set-car! cell (string->symbol \"z\"))"
+  "    (vector-set! vec 0 (make-string 10 #\\x))"
+  "    (bytevector-u8-set! bv 0 9)"
+  "    (string-set! word 0 #\\b)"
+  "    (string-copy! word 1 \"zz\")"
+  "    (hash-table-set! tbl 'k 2)"
+  "    (hash-table-set! tbl 'new (read (open-input-string str)))"
+  "    (set-point-x! pt 5)"
+  "    (parameterize ((p 30)) seen)))";
+
+static const char request[] =
+  "(define leaked (handle \"(1 2 3)\"))"
+  "(define-syntax swap! (syntax-rules () ((_ a b) (let ((t a)) (set! a b) (set! b t)))))"
+  "leaked";
+
+static const char expected[] = "(0 a 0 1 \"aaa\" 1 #f 1 1 10)";
+
+/* the last datum in str, or what it evaluates to if env is not #f */
+static pic_value
+read_all(pic_state *pic, const char *str, pic_value env)
+{
+  pic_value port = pic_fmemopen(pic, str, strlen(str), "r"), form, r = pic_undef_value(pic);
+
+  while (1) {
+    form = pic_funcall(pic, "read", 1, port);
+    if (pic_eof_p(pic, form))
+      break;
+    r = pic_false_p(pic, env) ? form : pic_funcall(pic, "eval", 2, form, env);
+  }
+  pic_fclose(pic, port);
+  return r;
+}
+
+static pic_value
+user_env(pic_state *pic)
+{
+  return pic_funcall(pic, "library-environment", 1, pic_intern_lit(pic, "picrin.user"));
+}
+
+/* a state ready to serve requests, and the procedure that serves them */
+static pic_state *
+open_state(pic_value *handle)
+{
+  pic_state *pic;
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+  pic_init_lib(pic);
+  pic_init_contrib(pic);
+  pic_load_piclib(pic);
+  pic_in_library(pic, "picrin.user");
+  read_all(pic, prelude, user_env(pic));
+  *handle = read_all(pic, "handle", user_env(pic));
+  return pic;
+}
+
+/* handles a request, by evaluating it if handle is #f */
+static int
+serve(pic_state *pic, pic_value handle)
+{
+  pic_value r;
+  size_t ai = pic_enter(pic);
+  int ok;
+
+  if (pic_false_p(pic, handle)) {
+    r = read_all(pic, request, user_env(pic));
+  } else {
+    r = pic_call(pic, handle, 1, pic_cstr_value(pic, "(1 2 3)"));
+  }
+  ok = pic_equal_p(pic, r, read_all(pic, expected, pic_false_value(pic)));
+  if (! ok) {
+    pic_fputs(pic, "got ", pic_stderr(pic));
+    pic_funcall(pic, "write", 2, r, pic_stderr(pic));
+    pic_fputs(pic, "\n", pic_stderr(pic));
+  }
+  pic_leave(pic, ai);
+  return ok;
+}
+
+/* whether the global defined by the last request is gone */
+static int
+forgotten(pic_state *pic)
+{
+  pic_value e;
+  size_t ai = pic_enter(pic);
+  int ok = 0;
+
+  pic_try {
+    read_all(pic, "leaked", user_env(pic));
+  }
+  pic_catch(e) {
+    (void) e;
+    ok = 1;
+  }
+  pic_leave(pic, ai);
+  return ok;
+}
+
+static double
+rate(int n, clock_t t)
+{
+  return n / ((double) (clock() - t) / CLOCKS_PER_SEC);
+}
+
+int
+main(void)
+{
+  pic_state *pic;
+  pic_value handle;
+  clock_t t;
+  int i;
+
+  pic = open_state(&handle);
+  pic_checkpoint(pic);
+
+  for (i = 0; i < 3; ++i) {
+    if (! serve(pic, pic_false_value(pic))) {
+      fprintf(stderr, "request %d saw a previous one\n", i);
+      return 1;
+    }
+    pic_reset(pic);
+    if (! forgotten(pic)) {
+      fprintf(stderr, "request %d left a global behind\n", i);
+      return 1;
+    }
+  }
+
+  t = clock();
+  for (i = 0; i < NREQUESTS; ++i) {
+    if (! serve(pic, handle)) {
+      fprintf(stderr, "request %d saw a previous one\n", i);
+      return 1;
+    }
+    pic_reset(pic);
+  }
+  printf("reset:      %8.0f requests/sec\n", rate(NREQUESTS, t));
+  pic_close(pic);
+
+  t = clock();
+  for (i = 0; i < NFRESH; ++i) {
+    pic = open_state(&handle);
+    if (! serve(pic, handle)) {
+      return 1;
+    }
+    pic_close(pic);
+  }
+  printf("fresh state:%8.0f requests/sec\n", rate(NFRESH, t));
+  return 0;
+}
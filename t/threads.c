@@ -0,0 +1,144 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+/*
+ * Runs a state per thread, all at once, each sending its result over a
+ * channel to the main thread. make test-threads builds this with
+ * -fsanitize=thread, so anything the states share without saying so
+ * shows up as a data race.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "picrin/lib.h"
+#include "picrin/channel.h"
+
+#define NTHREADS 4
+
+void pic_init_lib(pic_state *);
+void pic_init_contrib(pic_state *);
+void pic_load_piclib(pic_state *);
+
+int picrin_argc;
+char **picrin_argv;
+char **picrin_envp;
+
+static const char program[] =
+  "(import (scheme base) (scheme read) (srfi 27) (picrin regexp))"
+  "(define (count-data n)"
+  "  (let loop ((i 0) (acc 0))"
+  "    (if (= i n)"
+  "        acc"
+  "        (loop (+ i 1) (+ acc (length (read (open-input-string \"(a \\\"b\\\" #\\\\c #t 1.5 #(6))\"))))))))"
+  "(define (randoms n)"
+  "  (let loop ((i 0))"
+  "    (or (= i n)"
+  "        (let ((x (random-real)))"
+  "          (and (< 0 x 1) (loop (+ i 1)))))))"
+  "(list (count-data 200) (randoms 200) (regexp-replace (regexp \",\") \"a,b,c\" \" \"))";
+
+static const char expected[] = "(1200 #t \"a b c\")";
+
+/* the last datum in str, or what it evaluates to if env is not #f */
+static pic_value
+read_all(pic_state *pic, const char *str, pic_value env)
+{
+  pic_value port = pic_fmemopen(pic, str, strlen(str), "r"), form, r = pic_undef_value(pic);
+
+  while (1) {
+    form = pic_funcall(pic, "read", 1, port);
+    if (pic_eof_p(pic, form))
+      break;
+    r = pic_false_p(pic, env) ? form : pic_funcall(pic, "eval", 2, form, env);
+  }
+  pic_fclose(pic, port);
+  return r;
+}
+
+struct worker {
+  pthread_t thread;
+  struct pic_channel *results;
+  int ok;
+};
+
+static void *
+run(void *arg)
+{
+  pic_state *pic;
+  pic_value env, r, e;
+  struct worker *w = arg;
+  int *ok = &w->ok;
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+
+  pic_try {
+    pic_init_lib(pic);
+    pic_init_contrib(pic);
+    pic_load_piclib(pic);
+    pic_in_library(pic, "picrin.user");
+
+    env = pic_funcall(pic, "library-environment", 1, pic_intern_lit(pic, "picrin.user"));
+    r = read_all(pic, program, env);
+    *ok = pic_equal_p(pic, r, read_all(pic, expected, pic_false_value(pic)));
+    if (! *ok) {
+      pic_fputs(pic, "got ", pic_stderr(pic));
+      pic_funcall(pic, "write", 2, r, pic_stderr(pic));
+      pic_fputs(pic, "\n", pic_stderr(pic));
+    }
+    pic_funcall(pic, "picrin.channel:channel-send!", 2, pic_channel_value(pic, w->results), r);
+  }
+  pic_catch(e) {
+    pic_fputs(pic, "error: ", pic_stderr(pic));
+    pic_funcall(pic, "write", 2, e, pic_stderr(pic));
+    pic_fputs(pic, "\n", pic_stderr(pic));
+    *ok = 0;
+    pic_funcall(pic, "picrin.channel:channel-send!", 2, pic_channel_value(pic, w->results), pic_false_value(pic));
+  }
+
+  pic_close(pic);
+  return NULL;
+}
+
+int
+main(void)
+{
+  struct worker workers[NTHREADS];
+  pic_state *pic;
+  pic_value results, expect;
+  int i, failed = 0;
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+  pic_init_lib(pic);
+  pic_init_contrib(pic);
+  results = pic_make_channel(pic);
+  expect = read_all(pic, expected, pic_false_value(pic));
+
+  for (i = 0; i < NTHREADS; ++i) {
+    workers[i].results = pic_channel_ptr(pic, results);
+    if (pthread_create(&workers[i].thread, NULL, run, &workers[i]) != 0) {
+      fprintf(stderr, "could not create thread %d\n", i);
+      return 1;
+    }
+  }
+  for (i = 0; i < NTHREADS; ++i) {
+    if (! pic_equal_p(pic, pic_funcall(pic, "picrin.channel:channel-receive", 1, results), expect)) {
+      fprintf(stderr, "result %d did not come through the channel\n", i);
+      failed = 1;
+    }
+  }
+  for (i = 0; i < NTHREADS; ++i) {
+    pthread_join(workers[i].thread, NULL);
+    if (! workers[i].ok) {
+      fprintf(stderr, "thread %d failed\n", i);
+      failed = 1;
+    }
+  }
+  pic_close(pic);
+  if (! failed) {
+    printf("%d states ran concurrently\n", NTHREADS);
+  }
+  return failed;
+}
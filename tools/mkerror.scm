@@ -6,7 +6,7 @@
         (loop)))))
 
 (for-each
- display
+ write-string
  `("\n"
    "#if PIC_USE_ERROR\n"
    "static "))
@@ -18,13 +18,13 @@
       (loop))))
 
 (for-each
- display
+ write-string
  `("#endif\n"
    "\n"
    "void\n"
    "pic_init_error(pic_state *PIC_UNUSED(pic))\n"
    "{\n"
    "#if PIC_USE_ERROR\n"
-   "  pic_call(pic, pic_deserialize(pic, pic_blob_value(pic, error_rom, sizeof error_rom)), 0);\n"
+   "  pic_call(pic, pic_deserialize_static(pic, error_rom, sizeof error_rom, pic_false_value(pic)), 0);\n"
    "#endif\n"
    "}\n"))
@@ -1,5 +1,5 @@
 (for-each
- display
+ write-string
  `("#include \"picrin.h\"\n"
    "#include \"picrin/extra.h\"\n"
    "\n"
@@ -13,13 +13,13 @@
       (loop))))
 
 (for-each
- display
+ write-string
  `("#endif\n"
    "\n"
    "void\n"
    "pic_init_eval(pic_state *PIC_UNUSED(pic))\n"
    "{\n"
    "#if PIC_USE_EVAL\n"
-   "  pic_call(pic, pic_deserialize(pic, pic_blob_value(pic, eval_rom, sizeof eval_rom)), 0);\n"
+   "  pic_call(pic, pic_deserialize_static(pic, eval_rom, sizeof eval_rom, pic_false_value(pic)), 0);\n"
    "#endif\n"
    "}\n"))
@@ -1,5 +1,5 @@
 (for-each
- display
+ write-string
  `("#include \"picrin.h\"\n"
    "#include \"picrin/extra.h\"\n"
    "\n"
@@ -12,10 +12,10 @@
       (loop))))
 
 (for-each
- display
+ write-string
  `("\n"
    "void\n"
    "pic_init_lib(pic_state *PIC_UNUSED(pic))\n"
    "{\n"
-   "  pic_call(pic, pic_deserialize(pic, pic_blob_value(pic, lib_rom, sizeof lib_rom)), 0);\n"
+   "  pic_call(pic, pic_deserialize_static(pic, lib_rom, sizeof lib_rom, pic_false_value(pic)), 0);\n"
    "}\n"))